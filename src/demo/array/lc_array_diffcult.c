@@ -11,6 +11,8 @@
 #include <stdio.h>
 
 #include "utils.h"
+#include "kth_select.h"
+#include "sudoku.h"
 
 /* https://leetcode.cn/problems/median-of-two-sorted-arrays/ */
 /* 给定两个大小分别为 m 和 n 的正序（从小到大）数组 nums1 和 nums2。请你找出并返回这两个正序数组的 中位数 。
@@ -38,6 +40,15 @@ nums2.length == n
 0 <= n <= 1000
 1 <= m + n <= 2000
 -106 <= nums1[i], nums2[i] <= 106 */
+#define KTH_SELECT_findMedianSortedArrays
+#if defined(KTH_SELECT_findMedianSortedArrays)
+double findMedianSortedArrays(int *nums1, int nums1Size, int *nums2,
+                              int nums2Size)
+{
+    /* binary search the split of the shorter array, nothing is copied */
+    return median_of_two(nums1, nums1Size, nums2, nums2Size);
+}
+#else
 double findMedianSortedArrays(int *nums1, int nums1Size, int *nums2,
                               int nums2Size)
 {
@@ -59,6 +70,7 @@ double findMedianSortedArrays(int *nums1, int nums1Size, int *nums2,
     }
     return (double)(arr[size / 2] + arr[size / 2 - 1]) / 2;
 }
+#endif
 
 void findMedianSortedArraysTest(void)
 {
@@ -72,7 +84,59 @@ void findMedianSortedArraysTest(void)
     printf("output: %fd\n", ans);
 }
 
+/* https://leetcode.cn/problems/sudoku-solver/ */
+/* 编写一个程序，通过填充空格来解决数独问题。
+
+数独的解法需 遵循如下规则：
+
+数字 1-9 在每一行只能出现一次。
+数字 1-9 在每一列只能出现一次。
+数字 1-9 在每一个以粗实线分隔的 3x3 宫内只能出现一次。
+数独部分空格内已填入了数字，空白格用 '.' 表示。
+
+提示：
+
+board.length == 9
+board[i].length == 9
+board[i][j] 是一位数字或者 '.'
+题目数据 保证 输入数独仅有一个解 */
+void solveSudoku(char **board, int boardSize, int *boardColSize)
+{
+    sudoku_grid_t grid;
+
+    for (int c = 0; c < SUDOKU_CELLS; c++) {
+        char ch = board[c / 9][c % 9];
+        grid[c] = ch == '.' ? 0 : (uint8_t)(ch - '0');
+    }
+    /* singles are propagated before every guess, most boards need none */
+    if (sudoku_solve(grid, 1) == 0) {
+        return;
+    }
+    for (int c = 0; c < SUDOKU_CELLS; c++) {
+        board[c / 9][c % 9] = (char)('0' + grid[c]);
+    }
+}
+
+void solveSudokuTest(void)
+{
+    char rows[9][10] = {"53..7....", "6..195...", ".98....6.",
+                        "8...6...3", "4..8.3..1", "7...2...6",
+                        ".6....28.", "...419..5", "....8..79"};
+    char *board[9];
+    int colSize[9];
+
+    for (int i = 0; i < 9; i++) {
+        board[i] = rows[i];
+        colSize[i] = 9;
+    }
+    solveSudoku(board, 9, colSize);
+    for (int i = 0; i < 9; i++) {
+        printf("%s\n", board[i]);
+    }
+}
+
 void lc_array_diffcult_test(void)
 {
     // findMedianSortedArraysTest();
+    // solveSudokuTest();
 }
@@ -18,6 +18,12 @@
 
 #include "utils.h"
 #include "uthash.h"
+#include "skiplist.h"
+#include "range_query.h"
+#include "jagged.h"
+#include "arena.h"
+#include "merge.h"
+#include "scan.h"
 
 /* 双指针 哈希表 单调栈 数学 计数 排序 */
 
@@ -311,6 +317,26 @@ void findPoisonedDurationTest(void)
 -231 <= nums[i] <= 231 - 1
 
 进阶：你能设计一个时间复杂度 O(n) 的解决方案吗？*/
+#define SKIP_LIST_thirdMax
+#if defined(SKIP_LIST_thirdMax)
+int thirdMax(int *nums, int numsSize)
+{
+    /* distinct values kept sorted incrementally, no re-sort of nums */
+    skiplist_t *sl = skiplist_create(SKIPLIST_KEY_INT);
+    int i;
+
+    if (sl == NULL) {
+        return 0;
+    }
+    for (i = 0; i < numsSize; i++) {
+        skiplist_insert_int(sl, nums[i], NULL);
+    }
+    size_t size = skiplist_size(sl);
+    int ans = skiplist_select(sl, size >= 3 ? size - 2 : size)->key.i;
+    skiplist_destroy(sl);
+    return ans;
+}
+#else
 int thirdMax(int *nums, int numsSize)
 {
     bubble_sort(nums, numsSize);
@@ -329,6 +355,7 @@ int thirdMax(int *nums, int numsSize)
 
     return nums[numsSize - 1];
 }
+#endif
 
 void thirdMaxTest(void)
 {
@@ -503,10 +530,53 @@ void print_users(void)
 
 #endif
 
+#define ARENA_intersection
 int *intersection(int *nums1, int nums1Size, int *nums2, int nums2Size,
                   int *returnSize)
 {
-#if defined(HASH_TABLE_intersection)
+#if defined(ARENA_intersection)
+    /* open addressing set of nums1 as scratch, the stack buffer covers the
+       usual sizes and larger inputs spill onto the heap */
+    char buf[8192];
+    arena_t a;
+    int bits = 1;
+
+    *returnSize = 0;
+    while ((1 << bits) < 2 * nums1Size) {
+        bits++;
+    }
+    int mask = (1 << bits) - 1;
+    arena_init_buffer(&a, buf, sizeof(buf), 0);
+    int *keys = (int *)arena_alloc(&a, sizeof(int) * (mask + 1));
+    char *state = (char *)arena_alloc(&a, mask + 1); /* 0 empty 1 set 2 out */
+    int *ans = (int *)malloc(sizeof(int) * MAX(MIN(nums1Size, nums2Size), 1));
+    if (keys == NULL || state == NULL || ans == NULL) {
+        arena_destroy(&a);
+        free(ans);
+        return NULL;
+    }
+    memset(state, 0, mask + 1);
+    for (int i = 0; i < nums1Size; i++) {
+        int h = (int)(((uint32_t)nums1[i] * 2654435761u) >> (32 - bits));
+        while (state[h] && keys[h] != nums1[i]) {
+            h = (h + 1) & mask;
+        }
+        keys[h] = nums1[i];
+        state[h] = 1;
+    }
+    for (int i = 0; i < nums2Size; i++) {
+        int h = (int)(((uint32_t)nums2[i] * 2654435761u) >> (32 - bits));
+        while (state[h] && keys[h] != nums2[i]) {
+            h = (h + 1) & mask;
+        }
+        if (state[h] == 1) {
+            ans[(*returnSize)++] = nums2[i];
+            state[h] = 2;
+        }
+    }
+    arena_destroy(&a);
+    return ans;
+#elif defined(HASH_TABLE_intersection)
     ht = NULL;
     int i;
     int size = nums1Size > nums2Size ? nums1Size : nums2Size;
@@ -615,6 +685,36 @@ numArray.sumRange(0, 5); // return -3 ((-2) + 0 + 3 + (-5) + 2 + (-1))
 -105 <= nums[i] <= 105
 0 <= i <= j < nums.length
 最多调用 104 次 sumRange 方法 */
+#define RANGE_QUERY_NumArray
+#if defined(RANGE_QUERY_NumArray)
+typedef struct {
+    range_query_t rq; /* prefix sums over an owned copy */
+} NumArray;
+
+NumArray *numArrayCreate(int *nums, int numsSize)
+{
+    NumArray *obj = (NumArray *)malloc(sizeof(NumArray));
+    if (obj == NULL) {
+        return NULL;
+    }
+    if (rq_init(&obj->rq, RQ_PREFIX_SUM, nums, numsSize) != 0) {
+        free(obj);
+        return NULL;
+    }
+    return obj;
+}
+
+int numArraySumRange(NumArray *obj, int left, int right)
+{
+    return (int)rq_query(&obj->rq, left, right);
+}
+
+void numArrayFree(NumArray *obj)
+{
+    rq_destroy(&obj->rq);
+    free(obj);
+}
+#else
 typedef struct {
     int *nums;
     int numsSize;
@@ -643,6 +743,7 @@ void numArrayFree(NumArray *obj)
 {
     free(obj);
 }
+#endif
 
 /**
  * Your NumArray struct will be instantiated and called as such:
@@ -840,6 +941,37 @@ nums 按升序排列 */
 /**
  * Note: The returned array must be malloced, assume caller calls free().
  */
+#define ARENA_summaryRanges
+#if defined(ARENA_summaryRanges)
+char **summaryRanges(int *nums, int numsSize, int *returnSize)
+{
+    /* pointers and strings share one block, "-2147483648->2147483647" is
+       the longest range at 24 bytes */
+    size_t ptrs = sizeof(char *) * numsSize;
+    char **ret = (char **)malloc(ptrs + 25 * (size_t)numsSize + 1);
+    char tmp[25];
+    arena_t a;
+
+    *returnSize = 0;
+    if (ret == NULL) {
+        return NULL;
+    }
+    arena_init_buffer(&a, (char *)ret + ptrs, 25 * (size_t)numsSize + 1,
+                      ARENA_NO_GROW);
+    for (int i = 0; i < numsSize;) {
+        int low = i++;
+        while (i < numsSize && (int64_t)nums[i] == (int64_t)nums[i - 1] + 1) {
+            i++;
+        }
+        int len = low < i - 1 ?
+                      sprintf(tmp, "%d->%d", nums[low], nums[i - 1]) :
+                      sprintf(tmp, "%d", nums[low]);
+        ret[(*returnSize)++] = arena_strndup(&a, tmp, len);
+    }
+    arena_destroy(&a);
+    return ret;
+}
+#else
 char **summaryRanges(int *nums, int numsSize, int *returnSize)
 {
     char **ret = (char **)malloc(sizeof(char *) * numsSize);
@@ -862,6 +994,7 @@ char **summaryRanges(int *nums, int numsSize, int *returnSize)
     }
     return ret;
 }
+#endif
 
 void summaryRangesTest(void)
 {
@@ -878,9 +1011,11 @@ void summaryRangesTest(void)
         return;
     }
     PRINT_ARRAY(ret, returnSize, "%s ");
+#if !defined(ARENA_summaryRanges)
     for (int i = 0; i < returnSize; i++) {
         free(ret[i]);
     }
+#endif
     free(ret);
 }
 
@@ -996,6 +1131,14 @@ void twoOutOfThreeTest(void)
 
 
 注意：本题与主站 1991 题相同：https://leetcode-cn.com/problems/find-the-middle-index-in-array/ */
+#define SCAN_pivotIndex
+
+#if defined(SCAN_pivotIndex)
+int pivotIndex(int *nums, int numsSize)
+{
+    return (int)scan_balance_index(nums, numsSize);
+}
+#else
 int pivotIndex(int *nums, int numsSize)
 {
     int i;
@@ -1014,9 +1157,45 @@ int pivotIndex(int *nums, int numsSize)
     }
     return -1;
 }
+#endif
 
 void pivotIndexTest(void)
 {
+    int nums[] = {1, 7, 3, 6, 5, 6};
+
+    printf("output: %d\n", pivotIndex(nums, ARRAY_SIZE(nums)));
+}
+
+/* https://leetcode.cn/problems/running-sum-of-1d-array/ */
+/* 给你一个数组 nums 。数组「动态和」的计算公式为：runningSum[i] = sum(nums[0]…nums[i]) 。
+
+请返回 nums 的动态和。
+
+示例 1：
+
+输入：nums = [1,2,3,4]
+输出：[1,3,6,10]
+解释：动态和计算过程为 [1, 1+2, 1+2+3, 1+2+3+4] 。
+
+提示：
+
+1 <= nums.length <= 1000
+-10^6 <= nums[i] <= 10^6 */
+int *runningSum(int *nums, int numsSize, int *returnSize)
+{
+    /* in place, the scan reads each element before writing it */
+    scan_prefix_sum(nums, nums, numsSize, 0);
+    *returnSize = numsSize;
+    return nums;
+}
+
+void runningSumTest(void)
+{
+    int nums[] = {1, 2, 3, 4};
+    int returnSize = 0;
+
+    int *ret = runningSum(nums, ARRAY_SIZE(nums), &returnSize);
+    PRINT_ARRAY(ret, returnSize, "%d ");
 }
 
 /* https://leetcode.cn/problems/intersection-of-two-arrays-ii/ */
@@ -1098,6 +1277,18 @@ void intersectTest(void)
 
 1 <= nums.length <= 105
 nums[i] 不是 0 就是 1. */
+#define SCAN_findMaxConsecutiveOnes
+
+#if defined(SCAN_findMaxConsecutiveOnes)
+int findMaxConsecutiveOnes(int *nums, int numsSize)
+{
+    if (nums == NULL) {
+        return 0;
+    }
+    /* 32 compares per mask, mixed masks read by bit tricks */
+    return (int)scan_longest_run(nums, numsSize, 1);
+}
+#else
 int findMaxConsecutiveOnes(int *nums, int numsSize)
 {
     if (nums == NULL) {
@@ -1114,9 +1305,13 @@ int findMaxConsecutiveOnes(int *nums, int numsSize)
     }
     return max;
 }
+#endif
 
 void findMaxConsecutiveOnesTest(void)
 {
+    int nums[] = {1, 1, 0, 1, 1, 1};
+
+    printf("output: %d\n", findMaxConsecutiveOnes(nums, ARRAY_SIZE(nums)));
 }
 
 /* https://leetcode.cn/problems/array-partition/ */
@@ -1575,6 +1770,15 @@ void singleNumberTest(void)
 
 1 <= prices.length <= 105
 0 <= prices[i] <= 104 */
+#define SCAN_maxProfit
+
+#if defined(SCAN_maxProfit)
+int maxProfit(int *prices, int pricesSize)
+{
+    /* best price minus the lowest one before it, per segment then joined */
+    return (int)scan_max_gain(prices, pricesSize, 0);
+}
+#else
 int maxProfit(int *prices, int pricesSize)
 {
     int tmp = prices[0];
@@ -1591,6 +1795,7 @@ int maxProfit(int *prices, int pricesSize)
 
     return diff;
 }
+#endif
 
 void maxProfitTest(void)
 {
@@ -1643,9 +1848,31 @@ void getRowTest(void)
  * The sizes of the arrays are returned as *returnColumnSizes array.
  * Note: Both returned array and *columnSizes array must be malloced, assume caller calls free().
  */
+#define JAGGED_generate
 int **generate(int numRows, int *returnSize, int **returnColumnSizes)
 {
-#if defined(DP_generate)
+#if defined(JAGGED_generate)
+    jagged_t jg;
+
+    /* the shape is known, so the hints leave nothing to grow */
+    if (jagged_init(&jg, numRows, (size_t)numRows * (numRows + 1) / 2) != 0) {
+        return NULL;
+    }
+    for (int i = 0; i < numRows; i++) {
+        int *row = jagged_begin_row(&jg, i + 1);
+        row[0] = row[i] = 1;
+        if (i > 1) {
+            const int *prev = jagged_row(&jg, i - 1);
+            for (int j = 1; j < i; j++) {
+                row[j] = prev[j - 1] + prev[j];
+            }
+        }
+        jagged_end_row(&jg, i + 1);
+    }
+    int **ret = jagged_export(&jg, returnSize, returnColumnSizes);
+    jagged_destroy(&jg);
+    return ret;
+#elif defined(DP_generate)
     int **dp = (int **)malloc(sizeof(int *) * numRows);
     *returnColumnSizes = (int *)malloc(sizeof(int) * numRows);
     *returnSize = numRows;
@@ -1743,6 +1970,15 @@ nums2.length == n
 
 
 进阶：你可以设计实现一个时间复杂度为 O(m + n) 的算法解决此问题吗？ */
+#define MERGE_merge_stored_array
+#if defined(MERGE_merge_stored_array)
+void merge_stored_array(int *nums1, int nums1Size, int m, int *nums2,
+                        int nums2Size, int n)
+{
+    /* fill nums1 from the back, the free tail is never overrun */
+    merge_backward(nums1, m, nums2, n);
+}
+#else
 void arr_right_shift(int *nums, int len, int s, int e)
 {
     for (int i = s; i > e; i--) {
@@ -1772,9 +2008,16 @@ void merge_stored_array(int *nums1, int nums1Size, int m, int *nums2,
         }
     }
 }
+#endif
 
 void mergeTest(void)
 {
+    int nums1[] = {1, 2, 3, 0, 0, 0};
+    int nums2[] = {2, 5, 6};
+    int n1 = ARRAY_SIZE(nums1);
+
+    merge_stored_array(nums1, n1, 3, nums2, ARRAY_SIZE(nums2), 3);
+    PRINT_ARRAY(nums1, n1, "%d ");
 }
 
 /* https://leetcode.cn/problems/plus-one/ */
@@ -1832,6 +2075,14 @@ int *plusOne(int *digits, int digitsSize, int *returnSize)
 
 void plusOneTest(void)
 {
+    int digits[] = {9, 9, 9};
+    int returnSize = 0;
+
+    int *ret = plusOne(digits, ARRAY_SIZE(digits), &returnSize);
+    PRINT_ARRAY(ret, returnSize, "%d ");
+    if (ret != digits) {
+        free(ret);
+    }
 }
 
 /* https://leetcode.cn/problems/search-insert-position/ */
@@ -2164,4 +2415,7 @@ void lc_array_easy_test(void)
     // missingNumberTest();
     // intersectionTest();
     // nextGreaterElementTest();
+    // pivotIndexTest();
+    // runningSumTest();
+    // findMaxConsecutiveOnesTest();
 }
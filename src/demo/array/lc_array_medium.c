@@ -16,6 +16,10 @@
 #include <math.h>
 
 #include "utils.h"
+#include "ksum.h"
+#include "jagged.h"
+#include "sudoku.h"
+#include "matrix.h"
 
 /* https://leetcode.cn/problems/two-sum-ii-input-array-is-sorted/ */
 /* 给你一个下标从 1 开始的整数数组 numbers ，该数组已按 非递减顺序排列  ，请你从数组中找出满足相加之和等于目标数 target 的两个数。如果设这两个数分别是 numbers[index1] 和 numbers[index2] ，则 1 <= index1 < index2 <= numbers.length 。
@@ -120,6 +124,29 @@ nums[0] + nums[3] + nums[4] = (-1) + 2 + (-1) = 0 。
  * The sizes of the arrays are returned as *returnColumnSizes array.
  * Note: Both returned array and *columnSizes array must be malloced, assume caller calls free().
  */
+#define KSUM_threeSum
+#if defined(KSUM_threeSum)
+int **threeSum(int *nums, int numsSize, int *returnSize,
+               int **returnColumnSizes)
+{
+    ksum_result_t res;
+
+    *returnSize = 0;
+    *returnColumnSizes = NULL;
+    qsort(nums, numsSize, sizeof(int), cmp);
+    ksum_result_init(&res, 3);
+    if (ksum_find(nums, numsSize, 3, 0, &res) != 0) {
+        ksum_result_destroy(&res);
+        return NULL;
+    }
+
+    /* row pointers and triplets share one block, free(ret) releases both */
+    int **ret = jagged_export_fixed(res.data, (int)res.count, 3, returnSize,
+                                    returnColumnSizes);
+    ksum_result_destroy(&res);
+    return ret;
+}
+#else
 int **threeSum(int *nums, int numsSize, int *returnSize,
                int **returnColumnSizes)
 {
@@ -172,9 +199,21 @@ int **threeSum(int *nums, int numsSize, int *returnSize,
 
     return ret;
 }
+#endif
 
 void threeSumTest(void)
 {
+    int nums[] = {-1, 0, 1, 2, -1, -4};
+    int numsSize = sizeof(nums) / sizeof(int);
+    int returnSize;
+    int *returnColumnSizes;
+
+    int **ret = threeSum(nums, numsSize, &returnSize, &returnColumnSizes);
+    for (int r = 0; r < returnSize; r++) {
+        PRINT_ARRAY(ret[r], returnColumnSizes[r], "%d ");
+    }
+    free(ret);
+    free(returnColumnSizes);
 }
 
 /* https://leetcode.cn/problems/zero-matrix-lcci/ */
@@ -208,6 +247,20 @@ void threeSumTest(void)
   [0,4,5,0],
   [0,3,1,0]
 ] */
+#define MATRIX_setZeroes
+#if defined(MATRIX_setZeroes)
+/* 标记行: 第一个含 0 的行记录列标记, 全部按行扫描 */
+void setZeroes(int **matrix, int matrixSize, int *matrixColSize)
+{
+    matrix_view_t v;
+
+    if (matrix_view_open(&v, matrix, matrixSize, *matrixColSize) != 0) {
+        return;
+    }
+    matrix_set_zeroes(v.data, v.rows, v.cols, v.ld);
+    matrix_view_close(&v, true);
+}
+#else
 void setZeroes(int **matrix, int matrixSize, int *matrixColSize)
 {
     int M = matrixSize;
@@ -245,9 +298,16 @@ void setZeroes(int **matrix, int matrixSize, int *matrixColSize)
     free(rowRecord);
     free(colRecord);
 }
+#endif
 
 void setZeroesTest(void)
 {
+    int a[3][4] = {{0, 1, 2, 0}, {3, 4, 5, 2}, {1, 3, 1, 5}};
+    int *matrix[3] = {a[0], a[1], a[2]};
+    int cols = 4;
+
+    setZeroes(matrix, 3, &cols);
+    PRINT_ARRAY2D(matrix, 3, 4, "%d ");
 }
 
 /* https://leetcode.cn/problems/rotate-matrix-lcci/submissions/ */
@@ -287,6 +347,19 @@ void setZeroesTest(void)
   [16, 7,10,11]
 ]
 注意：本题与主站 48 题相同：https://leetcode-cn.com/problems/rotate-image/ */
+#define MATRIX_rotate
+#if defined(MATRIX_rotate)
+void rotate(int **matrix, int matrixSize, int *matrixColSize)
+{
+    matrix_view_t v;
+
+    if (matrix_view_open(&v, matrix, matrixSize, matrixSize) != 0) {
+        return;
+    }
+    matrix_rotate(v.data, v.rows, v.ld);
+    matrix_view_close(&v, true);
+}
+#else
 void rotate(int **matrix, int matrixSize, int *matrixColSize)
 {
     // 水平翻转
@@ -302,12 +375,27 @@ void rotate(int **matrix, int matrixSize, int *matrixColSize)
         }
     }
 }
+#endif
 
 void rotateTest(void)
 {
+    int a[4][4] = {
+        {5, 1, 9, 11}, {2, 4, 8, 10}, {13, 3, 6, 7}, {15, 14, 12, 16}};
+    int *matrix[4] = {a[0], a[1], a[2], a[3]};
+    int cols = 4;
+
+    rotate(matrix, 4, &cols);
+    PRINT_ARRAY2D(matrix, 4, 4, "%d ");
 }
 
 /* https://leetcode.cn/problems/rotate-image/ */
+#define MATRIX_rotate_image
+#if defined(MATRIX_rotate_image)
+void rotate_image(int **matrix, int matrixSize, int *matrixColSize)
+{
+    rotate(matrix, matrixSize, matrixColSize);
+}
+#else
 void rotate_image(int **matrix, int matrixSize, int *matrixColSize)
 {
     int i, j, temp;
@@ -330,9 +418,16 @@ void rotate_image(int **matrix, int matrixSize, int *matrixColSize)
         }
     }
 }
+#endif
 
 void rotateImageTest(void)
 {
+    int a[3][3] = {{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+    int *matrix[3] = {a[0], a[1], a[2]};
+    int cols = 3;
+
+    rotate_image(matrix, 3, &cols);
+    PRINT_ARRAY2D(matrix, 3, 3, "%d ");
 }
 
 /* https://leetcode.cn/problems/minimum-size-subarray-sum/ */
@@ -439,7 +534,44 @@ intervals[i].length == 2
  * The sizes of the arrays are returned as *returnColumnSizes array.
  * Note: Both returned array and *columnSizes array must be malloced, assume caller calls free().
  */
+#define JAGGED_merge_intervals
+#if defined(JAGGED_merge_intervals)
+static int interval_cmp(const void *pa, const void *pb)
+{
+    const int *a = *(int *const *)pa;
+    const int *b = *(int *const *)pb;
+    return (a[0] > b[0]) - (a[0] < b[0]);
+}
 
+int **merge_intervals(int **intervals, int intervalsSize, int *intervalsColSize,
+                      int *returnSize, int **returnColumnSizes)
+{
+    /* merged pairs back to back, at most one per input interval */
+    int *out = (int *)malloc(sizeof(int) * 2 * intervalsSize + 1);
+    int count = 0;
+
+    *returnSize = 0;
+    *returnColumnSizes = NULL;
+    if (out == NULL) {
+        printf("Memory allocation failed.\n");
+        return NULL;
+    }
+    qsort(intervals, intervalsSize, sizeof(int *), interval_cmp);
+    for (int i = 0; i < intervalsSize; i++) {
+        if (count > 0 && intervals[i][0] <= out[2 * count - 1]) {
+            out[2 * count - 1] = MAX(out[2 * count - 1], intervals[i][1]);
+        } else {
+            out[2 * count] = intervals[i][0];
+            out[2 * count + 1] = intervals[i][1];
+            count++;
+        }
+    }
+    int **ret =
+        jagged_export_fixed(out, count, 2, returnSize, returnColumnSizes);
+    free(out);
+    return ret;
+}
+#else
 int **merge_intervals(int **intervals, int intervalsSize, int *intervalsColSize,
                       int *returnSize, int **returnColumnSizes)
 {
@@ -474,9 +606,24 @@ int **merge_intervals(int **intervals, int intervalsSize, int *intervalsColSize,
     }
     return result;
 }
+#endif
 
 void merge2Test(void)
 {
+    int rows[][2] = {{8, 10}, {1, 3}, {15, 18}, {2, 6}};
+    int *intervals[] = {rows[0], rows[1], rows[2], rows[3]};
+    int intervalsSize = sizeof(intervals) / sizeof(int *);
+    int intervalsColSize[] = {2, 2, 2, 2};
+    int returnSize;
+    int *returnColumnSizes;
+
+    int **ret = merge_intervals(intervals, intervalsSize, intervalsColSize,
+                                &returnSize, &returnColumnSizes);
+    for (int r = 0; r < returnSize; r++) {
+        PRINT_ARRAY(ret[r], returnColumnSizes[r], "%d ");
+    }
+    free(ret);
+    free(returnColumnSizes);
 }
 
 /* https://leetcode.cn/problems/best-time-to-buy-and-sell-stock-ii/ */
@@ -539,6 +686,14 @@ void maxProfit2Test(void)
 }
 
 /* https://leetcode.cn/problems/valid-sudoku/ */
+#define SUDOKU_isValidSudoku
+#if defined(SUDOKU_isValidSudoku)
+bool isValidSudoku(char **board, int boardSize, int *boardColSize)
+{
+    /* one pass, a digit bit per row, column and box */
+    return sudoku_valid_board(board);
+}
+#else
 bool isValidSudoku(char **board, int boardSize, int *boardColSize)
 {
     int cnt[9];
@@ -596,9 +751,21 @@ bool isValidSudoku(char **board, int boardSize, int *boardColSize)
     }
     return true;
 }
+#endif
 
 void isValidSudokuTest(void)
 {
+    char rows[9][10] = {"53..7....", "6..195...", ".98....6.",
+                        "8...6...3", "4..8.3..1", "7...2...6",
+                        ".6....28.", "...419..5", "....8..79"};
+    char *board[9];
+    int colSize[9];
+
+    for (int i = 0; i < 9; i++) {
+        board[i] = rows[i];
+        colSize[i] = 9;
+    }
+    printf("output: %d\n", isValidSudoku(board, 9, colSize));
 }
 
 /* https://leetcode.cn/problems/find-minimum-in-rotated-sorted-array/ */
@@ -656,6 +823,27 @@ void findMinTest(void)
 /**
  * Note: The returned array must be malloced, assume caller calls free().
  */
+#define MATRIX_findDiagonalOrder
+#if defined(MATRIX_findDiagonalOrder)
+int *findDiagonalOrder(int **mat, int matSize, int *matColSize, int *returnSize)
+{
+    matrix_view_t v;
+    int *res = (int *)malloc(sizeof(int) * matSize * *matColSize);
+
+    *returnSize = 0;
+    if (res == NULL) {
+        printf("Memory allocation failed.\n");
+        return NULL;
+    }
+    if (matrix_view_open(&v, mat, matSize, *matColSize) != 0) {
+        free(res);
+        return NULL;
+    }
+    *returnSize = matrix_diagonal_order(v.data, v.rows, v.cols, v.ld, res);
+    matrix_view_close(&v, false);
+    return res;
+}
+#else
 int *findDiagonalOrder(int **mat, int matSize, int *matColSize, int *returnSize)
 {
     if (mat == NULL) {
@@ -698,9 +886,21 @@ int *findDiagonalOrder(int **mat, int matSize, int *matColSize, int *returnSize)
     *returnSize = index;
     return res;
 }
+#endif
 
 void findDiagonalOrderTest(void)
 {
+    int a[3][3] = {{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+    int *mat[3] = {a[0], a[1], a[2]};
+    int cols = 3;
+    int returnSize;
+
+    int *res = findDiagonalOrder(mat, 3, &cols, &returnSize);
+    if (res == NULL) {
+        return;
+    }
+    PRINT_ARRAY(res, returnSize, "%d ");
+    free(res);
 }
 
 /* https://leetcode.cn/problems/3sum-closest/ */
@@ -728,6 +928,15 @@ void findDiagonalOrderTest(void)
 3 <= nums.length <= 1000
 -1000 <= nums[i] <= 1000
 -104 <= target <= 104 */
+#define KSUM_threeSumClosest
+#if defined(KSUM_threeSumClosest)
+int threeSumClosest(int *nums, int numsSize, int target)
+{
+    qsort(nums, numsSize, sizeof(int), cmp);
+    /* the sum is in 64 bits, then the closest of two ties is the smaller */
+    return (int)ksum_closest3(nums, numsSize, target);
+}
+#else
 int threeSumClosest(int *nums, int numsSize, int target)
 {
     int sum = 0;
@@ -765,6 +974,7 @@ int threeSumClosest(int *nums, int numsSize, int target)
 
     return closest;
 }
+#endif
 
 /*
     升序
@@ -893,6 +1103,12 @@ void lc_array_medium_test(void)
     // divideTest();
     // maxAreaTest();
     // threeSumClosestTest();
+    // threeSumTest();
+    // merge2Test();
+    // isValidSudokuTest();
     // findDiagonalOrderTest();
+    // setZeroesTest();
+    // rotateTest();
+    // rotateImageTest();
     // findMinTest();
 }
@@ -8,6 +8,12 @@
  * @copyright Copyright (c) 2023
  *
  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "jagged.h"
 
 /* https://leetcode.cn/problems/gray-code/ */
 /**
@@ -51,6 +57,32 @@ nums 中的所有元素 互不相同 */
  * The sizes of the arrays are returned as *returnColumnSizes array.
  * Note: Both returned array and *columnSizes array must be malloced, assume caller calls free().
  */
+#define JAGGED_subsets
+#if defined(JAGGED_subsets)
+int **subsets(int *nums, int numsSize, int *returnSize, int **returnColumnSizes)
+{
+    int total = 1 << numsSize;
+    jagged_t jg;
+
+    /* every element is in half of the subsets */
+    if (jagged_init(&jg, total, (size_t)numsSize * total / 2) != 0) {
+        return NULL;
+    }
+    for (int mask = 0; mask < total; mask++) {
+        int *row = jagged_begin_row(&jg, numsSize);
+        int n = 0;
+        for (int i = 0; i < numsSize; i++) {
+            if (mask & (1 << i)) {
+                row[n++] = nums[i];
+            }
+        }
+        jagged_end_row(&jg, n);
+    }
+    int **ret = jagged_export(&jg, returnSize, returnColumnSizes);
+    jagged_destroy(&jg);
+    return ret;
+}
+#else
 int **subsets(int *nums, int numsSize, int *returnSize, int **returnColumnSizes)
 {
     int **ans = (int **)malloc(sizeof(int *) * (1 << numsSize));
@@ -74,3 +106,4 @@ int **subsets(int *nums, int numsSize, int *returnSize, int **returnColumnSizes)
     }
     return ans;
 }
+#endif
@@ -10,8 +10,10 @@
  */
 
 #include "stdio.h"
+#include "string.h"
 
 #include "utils.h"
+#include "edit_distance.h"
 
 /* https://leetcode.cn/problems/edit-distance/ */
 /* 给你两个单词 word1 和 word2， 请返回将 word1 转换成 word2 所使用的最少操作数  。
@@ -49,7 +51,8 @@ exection -> execution (插入 'u')
 word1 和 word2 由小写英文字母组成 */
 int minDistance(char *word1, char *word2)
 {
-    return 0;
+    /* bit-parallel DP, 500 bytes take 8 machine words per column */
+    return edit_distance(word1, strlen(word1), word2, strlen(word2));
 }
 
 int minDistanceTest(void)
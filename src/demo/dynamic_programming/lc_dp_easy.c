@@ -12,6 +12,7 @@
 #include "stdio.h"
 
 #include "utils.h"
+#include "linrec.h"
 
 /* 数学归纳法 */
 
@@ -43,6 +44,15 @@ int getMaximumGenerated(int n)
 }
 
 /* https://leetcode.cn/problems/n-th-tribonacci-number/ */
+#define LINREC_tribonacci
+
+#if defined(LINREC_tribonacci)
+int tribonacci(int n)
+{
+    /* a table load for every n that fits, matrix power past it */
+    return (int)linrec_tribonacci(n, 0);
+}
+#else
 int tribonacci(int n)
 {
     if (n == 0) {
@@ -63,6 +73,7 @@ int tribonacci(int n)
     }
     return s;
 }
+#endif
 
 /* https://leetcode.cn/problems/min-cost-climbing-stairs/ */
 int minCostClimbingStairs(int *cost, int costSize)
@@ -115,6 +126,14 @@ F(n) = F(n - 1) + F(n - 2)，其中 n > 1
 提示：
 
 0 <= n <= 30 */
+#define LINREC_fib
+
+#if defined(LINREC_fib)
+int fib(int n)
+{
+    return (int)linrec_fib(n, 0);
+}
+#else
 int fib(int n)
 {
     if (n < 2) {
@@ -132,6 +151,7 @@ int fib(int n)
     }
     return dp[n];
 }
+#endif
 
 /* https://leetcode.cn/problems/climbing-stairs/ */
 /*
@@ -158,6 +178,15 @@ int fib(int n)
 提示：
 
 1 <= n <= 45 */
+#define LINREC_climbStairs
+
+#if defined(LINREC_climbStairs)
+int climbStairs(int n)
+{
+    /* f(n) = f(n - 1) + f(n - 2) from f(1) = 1, f(2) = 2, that is F(n + 1) */
+    return (int)linrec_fib(n + 1, 0);
+}
+#else
 int climbStairs(int n)
 {
     if (n <= 2) {
@@ -176,6 +205,7 @@ int climbStairs(int n)
     }
     return dp[n];
 }
+#endif
 
 int climbStairsTest(void)
 {
@@ -186,10 +216,19 @@ int climbStairsTest(void)
     return 0;
 }
 
+int fibTest(void)
+{
+    int n = 30;
+    printf("input:%d\n", n);
+    printf("output: fib=%d tribonacci=%d\n", fib(n), tribonacci(n));
+    return 0;
+}
+
 int lc_dp_easy_test(void)
 {
     int ret = -1;
     // ret = climbStairsTest();
+    // ret = fibTest();
     // ret = minCostClimbingStairsTest();
     return ret;
 }
@@ -15,8 +15,19 @@
 #include "math.h"
 
 #include "utils.h"
+#include "grid_dp.h"
+#include "scan.h"
 
 /* https://leetcode.cn/problems/maximum-product-subarray/ */
+#define SCAN_maxProduct
+
+#if defined(SCAN_maxProduct)
+int maxProduct(int *nums, int numsSize)
+{
+    /* integer MIN/MAX, no round trip through fmax/fmin doubles */
+    return (int)scan_max_product(nums, numsSize);
+}
+#else
 int maxProduct(int *nums, int numsSize)
 {
     int ans = nums[0];
@@ -34,6 +45,7 @@ int maxProduct(int *nums, int numsSize)
     }
     return ans;
 }
+#endif
 
 /* https://leetcode.cn/problems/decode-ways/ */
 int numDecodings(char *s)
@@ -58,6 +70,19 @@ int numDecodings(char *s)
 }
 
 /* https://leetcode.cn/problems/minimum-path-sum/ */
+#define GRID_DP_minPathSum
+
+#if defined(GRID_DP_minPathSum)
+int minPathSum(int **grid, int gridSize, int *gridColSize)
+{
+    /* one rolling row instead of a gridSize x cols VLA */
+    int64_t sum = 0;
+    if (grid_dp_min_path_sum(grid, gridSize, *gridColSize, 0, &sum) != 0) {
+        return 0;
+    }
+    return (int)sum;
+}
+#else
 int minPathSum(int **grid, int gridSize, int *gridColSize)
 {
     if (gridSize <= 0 && *gridColSize <= 0) {
@@ -86,8 +111,18 @@ int minPathSum(int **grid, int gridSize, int *gridColSize)
     }
     return dp[gridSize - 1][*gridColSize - 1];
 }
+#endif
 
 /* https://leetcode.cn/problems/maximum-subarray/ */
+#define SCAN_maxSubArray
+
+#if defined(SCAN_maxSubArray)
+int maxSubArray(int *nums, int numsSize)
+{
+    /* Kadane over AVX2 segments, no dp array */
+    return (int)scan_max_subarray(nums, numsSize, 0);
+}
+#else
 int maxSubArray(int *nums, int numsSize)
 {
     int dp[numsSize];
@@ -106,8 +141,23 @@ int maxSubArray(int *nums, int numsSize)
     }
     return ans;
 }
+#endif
 
 /* https://leetcode.cn/problems/unique-paths-ii/ */
+#define GRID_DP_uniquePathsWithObstacles
+
+#if defined(GRID_DP_uniquePathsWithObstacles)
+int uniquePathsWithObstacles(int **obstacleGrid, int obstacleGridSize,
+                             int *obstacleGridColSize)
+{
+    uint64_t count = 0;
+    if (grid_dp_count_paths(obstacleGrid, obstacleGridSize,
+                            *obstacleGridColSize, 0, &count) != 0) {
+        return 0;
+    }
+    return (int)count;
+}
+#else
 int uniquePathsWithObstacles(int **obstacleGrid, int obstacleGridSize,
                              int *obstacleGridColSize)
 {
@@ -147,6 +197,7 @@ int uniquePathsWithObstacles(int **obstacleGrid, int obstacleGridSize,
     }
     return dp[obstacleGridSize - 1][*obstacleGridColSize - 1];
 }
+#endif
 
 /* https://leetcode.cn/problems/jump-game/ */
 bool canJump(int *nums, int numsSize)
@@ -205,6 +256,15 @@ bool canJump(int *nums, int numsSize)
 
 1 <= m, n <= 100
 题目数据保证答案小于等于 2 * 109 */
+#define GRID_DP_uniquePaths
+
+#if defined(GRID_DP_uniquePaths)
+int uniquePaths(int m, int n)
+{
+    /* C(m + n - 2, m - 1), no table at all */
+    return (int)grid_dp_unique_paths(m, n);
+}
+#else
 int uniquePaths(int m, int n)
 {
     if (m <= 0 && n <= 0) {
@@ -228,6 +288,7 @@ int uniquePaths(int m, int n)
     }
     return dp[m - 1][n - 1];
 }
+#endif
 
 int uniquePathsTest(void)
 {
@@ -239,9 +300,32 @@ int uniquePathsTest(void)
     return 0;
 }
 
+int minPathSumTest(void)
+{
+    int row0[] = {1, 3, 1}, row1[] = {1, 5, 1}, row2[] = {4, 2, 1};
+    int *grid[] = {row0, row1, row2};
+    int gridColSize = ARRAY_SIZE(row0);
+
+    int ret = minPathSum(grid, ARRAY_SIZE(grid), &gridColSize);
+    printf("output:%d\n", ret);
+    return 0;
+}
+
+int maxSubArrayTest(void)
+{
+    int nums[] = {-2, 1, -3, 4, -1, 2, 1, -5, 4};
+
+    printf("output: maxSubArray=%d maxProduct=%d\n",
+           maxSubArray(nums, ARRAY_SIZE(nums)),
+           maxProduct(nums, ARRAY_SIZE(nums)));
+    return 0;
+}
+
 int lc_dp_medium_test(void)
 {
     int ret = -1;
     // ret = uniquePathsTest();
+    // ret = minPathSumTest();
+    // ret = maxSubArrayTest();
     return ret;
 }
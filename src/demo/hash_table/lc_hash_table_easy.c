@@ -14,6 +14,10 @@
 
 #include "utils.h"
 #include "uthash.h"
+#include "skiplist.h"
+#include "aho_corasick.h"
+#include "jagged.h"
+#include "arena.h"
 
 /* 查找元素 元素去重 存储元素 */
 
@@ -299,7 +303,71 @@ char *destCity(char ***paths, int pathsSize, int *pathsColSize)
 #endif
 
 /* https://leetcode.cn/problems/find-the-difference-of-two-arrays/ */
-#if defined(HASH_TABLE_findDifference)
+#define JAGGED_findDifference
+#if defined(JAGGED_findDifference)
+/* distinct values of a that are missing from b, both sorted */
+static int sorted_diff(const int *a, int na, const int *b, int nb, int *out)
+{
+    int n = 0;
+
+    for (int i = 0, j = 0; i < na; i++) {
+        if (i > 0 && a[i] == a[i - 1]) {
+            continue;
+        }
+        while (j < nb && b[j] < a[i]) {
+            j++;
+        }
+        if (j == nb || b[j] != a[i]) {
+            out[n++] = a[i];
+        }
+    }
+    return n;
+}
+
+/**
+ * Return an array of arrays of size *returnSize.
+ * The sizes of the arrays are returned as *returnColumnSizes array.
+ * Note: Both returned array and *columnSizes array must be malloced, assume caller calls free().
+ */
+int **findDifference(int *nums1, int nums1Size, int *nums2, int nums2Size,
+                     int *returnSize, int **returnColumnSizes)
+{
+    jagged_t jg;
+
+    *returnSize = 0;
+    *returnColumnSizes = NULL;
+    if (jagged_init(&jg, 2, nums1Size + nums2Size) != 0) {
+        return NULL;
+    }
+    qsort(nums1, nums1Size, sizeof(int), cmp);
+    qsort(nums2, nums2Size, sizeof(int), cmp);
+    /* room for both rows is reserved, begin_row does not move data */
+    int *row = jagged_begin_row(&jg, nums1Size);
+    jagged_end_row(&jg, sorted_diff(nums1, nums1Size, nums2, nums2Size, row));
+    row = jagged_begin_row(&jg, nums2Size);
+    jagged_end_row(&jg, sorted_diff(nums2, nums2Size, nums1, nums1Size, row));
+    int **ret = jagged_export(&jg, returnSize, returnColumnSizes);
+    jagged_destroy(&jg);
+    return ret;
+}
+
+void findDifferenceTest(void)
+{
+    int nums1[] = {1, 2, 3, 3};
+    int nums2[] = {1, 1, 2, 2};
+    int returnSize;
+    int *returnColumnSizes;
+
+    int **ret = findDifference(nums1, sizeof(nums1) / sizeof(int), nums2,
+                               sizeof(nums2) / sizeof(int), &returnSize,
+                               &returnColumnSizes);
+    for (int r = 0; r < returnSize; r++) {
+        PRINT_ARRAY(ret[r], returnColumnSizes[r], "%d ");
+    }
+    free(ret);
+    free(returnColumnSizes);
+}
+#elif defined(HASH_TABLE_findDifference)
 typedef struct {
     int key;
     UT_hash_handle hh;
@@ -545,8 +613,52 @@ int *arrayRankTransform(int *arr, int arrSize, int *returnSize)
     }
     return ans;
 }
+#else
+/**
+ * Note: The returned array must be malloced, assume caller calls free().
+ */
+int *arrayRankTransform(int *arr, int arrSize, int *returnSize)
+{
+    *returnSize = arrSize;
+    if (arrSize == 0) {
+        return NULL;
+    }
+    /* the ordered set keeps distinct values sorted, rank is the position */
+    skiplist_t *sl = skiplist_create(SKIPLIST_KEY_INT);
+    int *ans = (int *)malloc(sizeof(int) * arrSize);
+    int i;
+
+    if (sl == NULL || ans == NULL) {
+        skiplist_destroy(sl);
+        free(ans);
+        *returnSize = 0;
+        return NULL;
+    }
+    for (i = 0; i < arrSize; i++) {
+        skiplist_insert_int(sl, arr[i], NULL);
+    }
+    for (i = 0; i < arrSize; i++) {
+        ans[i] = (int)skiplist_rank_int(sl, arr[i]);
+    }
+    skiplist_destroy(sl);
+    return ans;
+}
 #endif
 
+void arrayRankTransformTest(void)
+{
+    int arr[] = {37, 12, 28, 9, 100, 56, 80, 5, 12};
+    int arrSize = ARRAY_SIZE(arr);
+    int returnSize;
+
+    printf("input:\n");
+    PRINT_ARRAY(arr, arrSize, "%d ");
+    int *ret = arrayRankTransform(arr, arrSize, &returnSize);
+    printf("output:\n");
+    PRINT_ARRAY(ret, returnSize, "%d ");
+    free(ret);
+}
+
 /* https://leetcode.cn/problems/find-winner-on-a-tic-tac-toe-game/ */
 char *tictactoe(int **moves, int movesSize, int *movesColSize)
 {
@@ -1057,14 +1169,88 @@ char *mostCommonWord(char *paragraph, char **banned, int bannedSize)
     return ans;
 }
 
+#else
+typedef struct {
+    char *word; /* points into paragraph */
+    int cnt;
+    UT_hash_handle hh;
+} word_cnt_t;
+
+char *mostCommonWord(char *paragraph, char **banned, int bannedSize)
+{
+    /* banned words as one automaton walked from the root at every word
+       start, each paragraph byte is looked at once whatever bannedSize is */
+    ac_t ac;
+    ac_init(&ac, AC_ICASE);
+    for (int i = 0; i < bannedSize; i++) {
+        ac_add(&ac, banned[i], strlen(banned[i]));
+    }
+    if (ac_build(&ac) != 0) {
+        ac_destroy(&ac);
+        return NULL;
+    }
+
+    word_cnt_t *ht = NULL;
+    word_cnt_t *it, *t;
+    char *ans = NULL;
+    int max = 0;
+    int state = 0;
+    size_t len = 0;
+
+    /* words are lowercased and cut in place, like strtok */
+    for (char *p = paragraph;; p++) {
+        if (isalpha((unsigned char)*p)) {
+            *p = tolower((unsigned char)*p);
+            state = ac_step(&ac, state, *p);
+            len++;
+            continue;
+        }
+        bool end = *p == '\0';
+        if (len > 0 && ac_exact(&ac, state, len) < 0) {
+            char *word = p - len;
+            *p = '\0';
+            HASH_FIND(hh, ht, word, len, t);
+            if (t == NULL) {
+                t = (word_cnt_t *)malloc(sizeof *t);
+                if (t == NULL) {
+                    printf("Memory allocation failed.\n");
+                    ans = NULL;
+                    break;
+                }
+                t->word = word;
+                t->cnt = 0;
+                HASH_ADD_KEYPTR(hh, ht, t->word, len, t);
+            }
+            if (++t->cnt > max) {
+                max = t->cnt;
+                ans = t->word;
+            }
+        }
+        if (end) {
+            break;
+        }
+        state = 0;
+        len = 0;
+    }
+
+    HASH_ITER(hh, ht, it, t)
+    {
+        HASH_DEL(ht, it);
+        free(it);
+    }
+    ac_destroy(&ac);
+    return ans;
+}
+#endif
+
 int mostCommonWordTest(void)
 {
     char paragraph[] =
         "Bob hit a ball, the hit BALL flew far after it was hit.";
-    char *banned[] = {"hit"};
+    char *banned[] = {(char *)"hit"};
     int bannedSize = ARRAY_SIZE(banned);
     printf("input:%d\n", bannedSize);
-    PRINT_ARRAY(paragraph, strlen(paragraph), "%c");
+    PRINT_ARRAY(paragraph, (int)strlen(paragraph), "%c");
     char *ret = mostCommonWord(paragraph, banned, bannedSize);
     if (ret == NULL) {
         return -1;
@@ -1072,10 +1258,99 @@ int mostCommonWordTest(void)
     printf("output:%s\n", ret);
     return 0;
 }
-#endif
 
 /* https://leetcode.cn/problems/uncommon-words-from-two-sentences/submissions/ */
-#if defined(HASH_TABLE_uncommonFromSentences)
+#define ARENA_uncommonFromSentences
+#if defined(ARENA_uncommonFromSentences)
+typedef struct {
+    const char *word; /* points into the sentence */
+    int len;
+    int cnt;
+} word_slot_t;
+
+static void count_words(const char *s, word_slot_t *slots, int mask)
+{
+    while (*s != '\0') {
+        while (*s == ' ') {
+            s++;
+        }
+        const char *w = s;
+        uint32_t h = 2166136261u;
+        while (*s != ' ' && *s != '\0') {
+            h = (h ^ (unsigned char)*s++) * 16777619u;
+        }
+        int len = (int)(s - w);
+        if (len == 0) {
+            break;
+        }
+        int i = (int)(h & mask);
+        while (slots[i].word != NULL &&
+               (slots[i].len != len || memcmp(slots[i].word, w, len) != 0)) {
+            i = (i + 1) & mask;
+        }
+        slots[i].word = w;
+        slots[i].len = len;
+        slots[i].cnt++;
+    }
+}
+
+/**
+ * Note: The returned array must be malloced, assume caller calls free().
+ */
+char **uncommonFromSentences(char *s1, char *s2, int *returnSize)
+{
+    size_t len1 = strlen(s1), len2 = strlen(s2);
+    int words = (int)(len1 + len2) / 2 + 2;
+    int mask = 1;
+    char buf[4096];
+    arena_t scratch, out;
+
+    /* the word table is scratch, the stack buffer covers short sentences */
+    while (mask < 2 * words) {
+        mask <<= 1;
+    }
+    mask--;
+    *returnSize = 0;
+    arena_init_buffer(&scratch, buf, sizeof(buf), 0);
+    word_slot_t *slots =
+        (word_slot_t *)arena_alloc(&scratch, sizeof(word_slot_t) * (mask + 1));
+    /* pointers and words share the returned block */
+    size_t ptrs = sizeof(char *) * words;
+    char **ans = (char **)malloc(ptrs + len1 + len2 + words);
+    if (slots == NULL || ans == NULL) {
+        arena_destroy(&scratch);
+        free(ans);
+        return NULL;
+    }
+    memset(slots, 0, sizeof(word_slot_t) * (mask + 1));
+    count_words(s1, slots, mask);
+    count_words(s2, slots, mask);
+
+    arena_init_buffer(&out, (char *)ans + ptrs, len1 + len2 + words,
+                      ARENA_NO_GROW);
+    for (int i = 0; i <= mask; i++) {
+        if (slots[i].cnt == 1) {
+            ans[(*returnSize)++] =
+                arena_strndup(&out, slots[i].word, slots[i].len);
+        }
+    }
+    arena_destroy(&out);
+    arena_destroy(&scratch);
+    return ans;
+}
+
+int uncommonFromSentencesTest(void)
+{
+    char s1[] = "this apple is sweet";
+    char s2[] = "this apple is sour";
+    int returnSize;
+
+    char **ret = uncommonFromSentences(s1, s2, &returnSize);
+    PRINT_ARRAY(ret, returnSize, "%s ");
+    free(ret);
+    return 0;
+}
+#elif defined(HASH_TABLE_uncommonFromSentences)
 typedef struct {
     char *key;
     int val;
@@ -1930,6 +2205,7 @@ int myHashTest(void)
 int lc_hash_table_easy_test(void)
 {
     int ret = -1;
+    // arrayRankTransformTest();
     // isHappyTest();
     // xlongestPalindromeTest();
     // distributeCandiesTest();
@@ -1940,5 +2216,7 @@ int lc_hash_table_easy_test(void)
     // ret = repeatedNTimesTest();
     // ret = mostCommonWordTest();
     // ret = numUniqueEmailsTest();
+    // findDifferenceTest();
+    // ret = uncommonFromSentencesTest();
     return ret;
 }
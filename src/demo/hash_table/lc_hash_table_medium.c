@@ -8,9 +8,33 @@
  * @copyright Copyright (c) 2023
  *
  */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "uthash.h"
+#include "histogram.h"
 
 /* https://leetcode.cn/problems/sort-characters-by-frequency/ */
-#if defined(HASH_TABLE_frequencySort)
+#define HIST_frequencySort
+#if defined(HIST_frequencySort)
+/* 计数后按次数整段写出, 不用排序哈希表 */
+char *frequencySort(char *s)
+{
+    uint32_t h[HIST_SIZE];
+    size_t len = strlen(s);
+    char *ans = (char *)malloc(len + 1);
+
+    if (ans == NULL) {
+        printf("Memory allocation failed.\n");
+        return NULL;
+    }
+    hist_count(s, len, h);
+    ans[hist_sort_by_count(h, ans)] = '\0';
+    return ans;
+}
+#elif defined(HASH_TABLE_frequencySort)
 typedef struct {
     int key;
     int val;
@@ -64,3 +88,25 @@ char *frequencySort(char *s)
     return ans;
 }
 #endif
+
+#if defined(HIST_frequencySort) || defined(HASH_TABLE_frequencySort)
+int frequencySortTest(void)
+{
+    char s[] = "Aabbbtreee";
+
+    char *ans = frequencySort(s);
+    if (ans == NULL) {
+        return -1;
+    }
+    printf("output: %s\n", ans);
+    free(ans);
+    return 0;
+}
+#endif
+
+int lc_hash_table_medium_test(void)
+{
+    int ret = -1;
+    // ret = frequencySortTest();
+    return ret;
+}
@@ -28,6 +28,7 @@ int main(void)
 
     /* hash table */
     lc_hash_table_easy_test();
+    lc_hash_table_medium_test();
 
     /* stack */
     lc_stack_easy_test();
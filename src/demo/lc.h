@@ -23,6 +23,7 @@ void lc_string_diffcult_test(void);
 
 /* hash table */
 int lc_hash_table_easy_test(void);
+int lc_hash_table_medium_test(void);
 
 /* stack */
 void lc_stack_easy_test(void);
@@ -18,6 +18,12 @@
 
 #include "uthash.h"
 #include "utils.h"
+#include "str_search.h"
+#include "palindrome.h"
+#include "arena.h"
+#include "period.h"
+#include "bignum.h"
+#include "histogram.h"
 
 /* 双指针 哈希表 栈 贪心 库函数 */
 
@@ -150,9 +156,13 @@ s 的 旋转操作 就是将 s 最左边的字符移动到最右边。
 
 1 <= s.length, goal.length <= 100
 s 和 goal 由小写英文字母组成 */
+#define PERIOD_rotateString
 bool rotateString(char *s, char *goal)
 {
-#if defined(WAY1)
+#if defined(PERIOD_rotateString)
+    /* KMP of s over goal read twice round, no doubled copy */
+    return period_is_rotation(s, strlen(s), goal, strlen(goal));
+#elif defined(WAY1)
     size_t len = strlen(s);
     int i;
 
@@ -425,11 +435,28 @@ void toLowerCaseTest(void)
 s[i] 为 '0' 或 '1' */
 int countBinarySubstrings(char *s)
 {
-    return 0;
+    int ans = 0;
+    int prev = 0; /* length of the previous run */
+
+    /* each boundary between two runs contributes min of their lengths */
+    for (int i = 0; s[i] != '\0';) {
+        int j = i;
+        while (s[j] == s[i]) {
+            j++;
+        }
+        ans += MIN(prev, j - i);
+        prev = j - i;
+        i = j;
+    }
+    return ans;
 }
 
 void countBinarySubstringsTest(void)
 {
+    char s[] = "00110011";
+
+    printf("input:%s\n", s);
+    printf("output:%d\n", countBinarySubstrings(s));
 }
 
 /* https://leetcode.cn/problems/robot-return-to-origin/ */
@@ -1178,7 +1205,8 @@ void licenseKeyFormattingTest(void)
 s 由小写英文字母组成 */
 bool repeatedSubstringPattern(char *s)
 {
-    return 0;
+    /* a repetition exactly when the smallest period divides the length */
+    return period_is_repetition(s, strlen(s));
 }
 
 void repeatedSubstringPatternTest(void)
@@ -1294,6 +1322,17 @@ void countSegmentsTest(void)
 
 1 <= haystack.length, needle.length <= 104
 haystack 和 needle 仅由小写英文字符组成 */
+#define STR_SEARCH_strStr
+#if defined(STR_SEARCH_strStr)
+int strStr(char *haystack, char *needle)
+{
+    size_t ln = strlen(needle);
+    size_t lh = strlen(haystack);
+
+    const char *found = str_search(haystack, lh, needle, ln);
+    return found == NULL ? -1 : (int)(found - haystack);
+}
+#else
 int strStr(char *haystack, char *needle)
 {
     int i = 0, j = 0;
@@ -1314,6 +1353,7 @@ int strStr(char *haystack, char *needle)
     }
     return -1;
 }
+#endif
 
 void strStrTest(void)
 {
@@ -1410,6 +1450,7 @@ s 和 t 仅包含小写字母
 
 
 进阶: 如果输入字符串包含 unicode 字符怎么办？你能否调整你的解法来应对这种情况？ */
+#define HIST_isAnagram
 #undef HASH_TABLE_isAnagram
 #if defined(HASH_TABLE_isAnagram)
 typedef struct {
@@ -1421,7 +1462,16 @@ typedef struct {
 
 bool isAnagram(char *s, char *t)
 {
-#if defined(HASH_TABLE_isAnagram)
+#if defined(HIST_isAnagram)
+    size_t ls = strlen(s);
+    int32_t d[HIST_SIZE];
+
+    if (ls != strlen(t)) {
+        return false;
+    }
+    hist_count_diff(s, t, ls, d);
+    return hist_all_zero(d);
+#elif defined(HASH_TABLE_isAnagram)
     int ls = strlen(s);
     int lt = strlen(t);
     int i;
@@ -1519,6 +1569,22 @@ int isAnagramTest(void)
 
 1 <= s.length <= 105
 s 只包含小写字母 */
+#define HIST_firstUniqChar
+#if defined(HIST_firstUniqChar)
+int firstUniqChar(char *s)
+{
+    size_t len = strlen(s);
+    uint32_t h[HIST_SIZE];
+
+    hist_count(s, len, h);
+    for (size_t i = 0; i < len; i++) {
+        if (h[(unsigned char)s[i]] == 1) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+#else
 int firstUniqChar(char *s)
 {
     int *st = (int *)malloc(sizeof(int) * 26);
@@ -1536,6 +1602,7 @@ int firstUniqChar(char *s)
     }
     return -1;
 }
+#endif
 
 void firstUniqCharTest(void)
 {
@@ -1566,6 +1633,34 @@ void firstUniqCharTest(void)
 1 <= a.length, b.length <= 104
 a 和 b 仅由字符 '0' 或 '1' 组成
 字符串如果不是 "0" ，就不含前导零 */
+#define BIGNUM_addBinary
+#define BIGNUM_addStrings
+
+#if defined(BIGNUM_addBinary) || defined(BIGNUM_addStrings)
+/* 64 bits or 18 digits per limb add, the inputs are left untouched */
+static char *bignum_sum(const char *a, const char *b, bn_radix_t radix)
+{
+    bignum_t x, y;
+    char *res = NULL;
+
+    bn_init(&x, radix);
+    bn_init(&y, radix);
+    if (bn_parse(&x, a, strlen(a)) == 0 && bn_parse(&y, b, strlen(b)) == 0 &&
+        bn_add(&x, &x, &y) == 0) {
+        res = bn_to_string(&x);
+    }
+    bn_destroy(&x);
+    bn_destroy(&y);
+    return res;
+}
+#endif
+
+#if defined(BIGNUM_addBinary)
+char *addBinary(char *a, char *b)
+{
+    return bignum_sum(a, b, BN_BINARY);
+}
+#else
 void reverse2(char *s, int len)
 {
     for (int i = 0; i < len / 2; i++) {
@@ -1603,6 +1698,7 @@ char *addBinary(char *a, char *b)
     reverse2(res, strlen(res));
     return res;
 }
+#endif
 
 void addBinaryTest(void)
 {
@@ -1641,6 +1737,12 @@ void addBinaryTest(void)
 num1 和num2 都只包含数字 0-9
 num1 和num2 都不包含任何前导零 */
 
+#if defined(BIGNUM_addStrings)
+char *addStrings(char *num1, char *num2)
+{
+    return bignum_sum(num1, num2, BN_DECIMAL);
+}
+#else
 char *addStrings(char *num1, char *num2)
 {
     int n = string2int(num1) + string2int(num2);
@@ -1654,6 +1756,7 @@ char *addStrings(char *num1, char *num2)
 
     return s;
 }
+#endif
 
 void addStringsTest(void)
 {
@@ -1699,6 +1802,36 @@ answer[i] == i （以字符串形式）如果上述条件全不满足。
 /**
  * Note: The returned array must be malloced, assume caller calls free().
  */
+#define ARENA_fizzBuzz
+#if defined(ARENA_fizzBuzz)
+char **fizzBuzz(int n, int *returnSize)
+{
+    /* pointers and strings share one block, 9 bytes fit any answer */
+    size_t ptrs = sizeof(char *) * n;
+    char **s = (char **)malloc(ptrs + 9 * (size_t)n + 1);
+    char num[12];
+    arena_t a;
+
+    if (s == NULL) {
+        return NULL;
+    }
+    arena_init_buffer(&a, (char *)s + ptrs, 9 * (size_t)n + 1, ARENA_NO_GROW);
+    for (int i = 1; i <= n; i++) {
+        if (i % 15 == 0) {
+            s[i - 1] = arena_strndup(&a, "FizzBuzz", 8);
+        } else if (i % 3 == 0) {
+            s[i - 1] = arena_strndup(&a, "Fizz", 4);
+        } else if (i % 5 == 0) {
+            s[i - 1] = arena_strndup(&a, "Buzz", 4);
+        } else {
+            s[i - 1] = arena_strndup(&a, num, sprintf(num, "%d", i));
+        }
+    }
+    arena_destroy(&a);
+    *returnSize = n;
+    return s;
+}
+#else
 char **fizzBuzz(int n, int *returnSize)
 {
     int i;
@@ -1727,6 +1860,7 @@ char **fizzBuzz(int n, int *returnSize)
     }
     return s;
 }
+#endif
 
 void fizzBuzzTest(void)
 {
@@ -1742,10 +1876,12 @@ void fizzBuzzTest(void)
         printf("%s ", ret[i]);
     }
 
+#if !defined(ARENA_fizzBuzz)
     for (int i = 0; i < returnSize; i++) {
         free(ret[i]);
         ret[i] = NULL;
     }
+#endif
 
     free(ret);
     ret = NULL;
@@ -1775,6 +1911,13 @@ void fizzBuzzTest(void)
 
 1 <= s.length <= 105
 s 由小写英文字母组成 */
+#define PALINDROME_validPalindrome
+#if defined(PALINDROME_validPalindrome)
+bool validPalindrome(char *s)
+{
+    return palin_valid_delete_one(s, strlen(s));
+}
+#else
 bool validPalindrome(char *s)
 {
     /* abcxnyynmxcbea axbccbea */
@@ -1820,6 +1963,7 @@ bool validPalindrome(char *s)
     }
     return true;
 }
+#endif
 
 /* mlcupuufxxfuupuculm */
 /* uupucxxucupuu */
@@ -1861,6 +2005,26 @@ void validPalindromeTest(void)
 
 1 <= s.length <= 1000
 s 仅由数字和英文字母组成 */
+#define PALINDROME_longestPalindrome
+#if defined(PALINDROME_longestPalindrome)
+char *longestPalindrome(char *s)
+{
+    size_t start, len;
+
+    /* Manacher, linear instead of testing every substring */
+    if (palin_longest(s, strlen(s), &start, &len) != 0) {
+        return NULL;
+    }
+    char *ans = (char *)malloc(len + 1);
+    if (ans == NULL) {
+        printf("malloc fail");
+        return NULL;
+    }
+    memcpy(ans, s + start, len);
+    ans[len] = '\0';
+    return ans;
+}
+#else
 bool IsPalindrome(char *s, int left, int right)
 {
     while (left < right) {
@@ -1895,6 +2059,7 @@ char *longestPalindrome(char *s)
     }
     return NULL;
 }
+#endif
 
 void longestPalindromeTest(void)
 {
@@ -2073,8 +2238,20 @@ void isSubsequenceTest(void)
 0 <= s.length <= 1000
 t.length == s.length + 1
 s 和 t 只包含小写字母 */
+#define HIST_findTheDifference
 #define WAYS 1
-#if (WAYS == 1)
+#if defined(HIST_findTheDifference)
+/* 一遍计数差, t 多出的最后一个字符单独补上 */
+char findTheDifference(char *s, char *t)
+{
+    size_t n = strlen(s);
+    int32_t d[HIST_SIZE];
+
+    hist_count_diff(t, s, n, d);
+    d[(unsigned char)t[n]]++;
+    return (char)hist_first_positive(d);
+}
+#elif (WAYS == 1)
 /* 计数 */
 char findTheDifference(char *s, char *t)
 {
@@ -2186,7 +2363,17 @@ magazine 中的每个字符只能在 ransomNote 中使用一次。
 
 1 <= ransomNote.length, magazine.length <= 105
 ransomNote 和 magazine 由小写英文字母组成 */
-#if 1
+#define HIST_canConstruct
+#if defined(HIST_canConstruct)
+bool canConstruct(char *ransomNote, char *magazine)
+{
+    uint32_t need[HIST_SIZE], have[HIST_SIZE];
+
+    hist_count(ransomNote, strlen(ransomNote), need);
+    hist_count(magazine, strlen(magazine), have);
+    return hist_covers(have, need);
+}
+#elif 1
 bool canConstruct(char *ransomNote, char *magazine)
 {
     int a[26] = {0};
@@ -3135,5 +3322,6 @@ int lc_string_easy_test(void)
     int ret = -1;
     // romanToIntTest();
     // ret = isAnagramTest();
+    // countBinarySubstringsTest();
     return ret;
 }
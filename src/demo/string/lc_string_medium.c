@@ -14,6 +14,9 @@
 #include "math.h"
 #include "stdbool.h"
 
+#include "sliding_window.h"
+#include "rle.h"
+
 /* https://leetcode.cn/problems/string-to-integer-atoi/ */
 /* 请你来实现一个 myAtoi(string s) 函数，使其能将字符串转换成一个 32 位有符号整数（类似 C/C++ 中的 atoi 函数）。
 
@@ -128,6 +131,14 @@ void myAtoiTest(void)
 }
 
 /* https://leetcode.cn/problems/count-and-say/ */
+#define RLE_countAndSay
+#if defined(RLE_countAndSay)
+char *countAndSay(int n)
+{
+    /* iterative, two buffers swap roles and grow with the term */
+    return rle_count_and_say(n, NULL);
+}
+#else
 char *countAndSay(int n)
 {
     if (n == 1) {
@@ -151,6 +162,7 @@ char *countAndSay(int n)
 
     return ans;
 }
+#endif
 
 void countAndSayTest(void)
 {
@@ -192,6 +204,19 @@ void countAndSayTest(void)
 
 0 <= s.length <= 5 * 104
 s 由英文字母、数字、符号和空格组成 */
+#define SLIDING_WINDOW_lengthOfLongestSubstring
+#if defined(SLIDING_WINDOW_lengthOfLongestSubstring)
+int lengthOfLongestSubstring(char *s)
+{
+    /* the window jumps past the last occurrence of a repeated byte, no
+       rescan of the window */
+    sw_window_t w;
+
+    sw_init(&w, SW_NO_REPEAT);
+    sw_feed(&w, s, strlen(s));
+    return (int)sw_best(&w, NULL);
+}
+#else
 int lengthOfLongestSubstring(char *s)
 {
     if (!s[0]) {
@@ -214,7 +239,19 @@ int lengthOfLongestSubstring(char *s)
 
     return max;
 }
+#endif
+
+void lengthOfLongestSubstringTest(void)
+{
+    char s[] = "pwwkew";
+
+    int ans = lengthOfLongestSubstring(s);
+
+    printf("output: ans=%d\n", ans);
+}
 
 void lc_string_medium_test(void)
 {
+    // countAndSayTest();
+    // lengthOfLongestSubstringTest();
 }
@@ -590,6 +590,7 @@ int main(int argc, char *argv[])
     // test_light_switch();
     // test_door();
     // test_state();
+    // test_fsm_table();
 
     // test_bin();
 
@@ -604,5 +605,52 @@ int main(int argc, char *argv[])
     // test_delete_ch();
 
     // test_dp();
+
+    // test_unrolled_list();
+
+    // test_skiplist();
+
+    // test_timer_wheel();
+    // test_fsm_runtime();
+
+    // test_str_search();
+
+    // test_aho_corasick();
+
+    // test_sliding_window();
+
+    // test_palindrome();
+
+    // test_edit_distance();
+
+    // test_kth_select();
+
+    // test_range_query();
+
+    // test_ksum();
+
+    // test_jagged();
+
+    // test_arena();
+
+    // test_merge();
+
+    // test_rle();
+
+    // test_sudoku();
+
+    // test_period();
+
+    // test_bignum();
+
+    // test_linrec();
+
+    // test_grid_dp();
+
+    // test_scan();
+
+    // test_histogram();
+
+    // test_matrix();
     return 0;
 }
@@ -16,7 +16,55 @@ int test_memory_layout(void);
 int test_traffic_light(void);
 int test_light_switch(void);
 int test_state(void);
+int test_fsm_table(void);
 
 int test_hash_table(void);
 
+int test_unrolled_list(void);
+
+int test_skiplist(void);
+
+int test_timer_wheel(void);
+int test_fsm_runtime(void);
+
+int test_str_search(void);
+
+int test_aho_corasick(void);
+
+int test_sliding_window(void);
+
+int test_palindrome(void);
+
+int test_edit_distance(void);
+
+int test_kth_select(void);
+
+int test_range_query(void);
+
+int test_ksum(void);
+
+int test_jagged(void);
+
+int test_arena(void);
+
+int test_merge(void);
+
+int test_rle(void);
+
+int test_sudoku(void);
+
+int test_period(void);
+
+int test_bignum(void);
+
+int test_linrec(void);
+
+int test_grid_dp(void);
+
+int test_scan(void);
+
+int test_histogram(void);
+
+int test_matrix(void);
+
 #endif
@@ -0,0 +1,232 @@
+/**
+ * @file test_aho_corasick.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief Aho-Corasick test, match counts against one search per word and
+ * scan speed as the dictionary grows
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "utils.h"
+#include "aho_corasick.h"
+#include "str_search.h"
+#include "test.h"
+
+#define AC_TEST_ROUNDS 2000
+#define AC_TEXT_SIZE (1 << 20)
+#define AC_WORD_LEN 8
+
+static int ac_count_cb(void *arg, int id, size_t end)
+{
+    ((int *)arg)[id]++;
+    return 0;
+}
+
+/* occurrences of every word, overlaps included, one pass per word */
+static long count_per_word(const char *text, size_t len, char **words,
+                           int num, int *counts)
+{
+    long total = 0;
+
+    for (int i = 0; i < num; i++) {
+        size_t wl = strlen(words[i]);
+        const char *p = text;
+        counts[i] = 0;
+        while ((p = str_search(p, len - (p - text), words[i], wl)) != NULL) {
+            counts[i]++;
+            p++;
+        }
+        total += counts[i];
+    }
+    return total;
+}
+
+static void random_word(char *s, int len, int alphabet)
+{
+    for (int i = 0; i < len; i++) {
+        s[i] = 'a' + rand() % alphabet;
+    }
+    s[len] = '\0';
+}
+
+/* patterns over every byte value, NUL included, so all 256 columns are
+   in use, against a memcmp at every position */
+static int check_all_bytes(void)
+{
+    unsigned char text[600], pats[8][256];
+    size_t lens[8];
+    int errors = 0;
+
+    for (int r = 0; r < 200; r++) {
+        int num = 2 + rand() % 7;
+        ac_t ac;
+        ac_init(&ac, 0);
+        for (int i = 0; i < num; i++) {
+            lens[i] = i == 0 ? 256 : 1 + rand() % 3;
+            for (size_t k = 0; k < lens[i]; k++) {
+                pats[i][k] = i == 0 ? (unsigned char)k : rand() & 0xFF;
+            }
+            /* 0xFF is the last byte to get a column, start a word with it */
+            if (i == 1) {
+                pats[i][0] = 0xFF;
+            }
+            ac_add(&ac, (const char *)pats[i], lens[i]);
+        }
+        ac_build(&ac);
+        size_t len = sizeof(text);
+        for (size_t k = 0; k < len; k++) {
+            text[k] = rand() & 0xFF;
+        }
+        /* one full copy of the 0..255 pattern and runs of 0xFF */
+        memcpy(text + rand() % (len - 256), pats[0], 256);
+        memset(text + rand() % (len - 8), 0xFF, 8);
+
+        int got[8] = {0};
+        ac_scan(&ac, (const char *)text, len, ac_count_cb, got);
+        for (int i = 0; i < num; i++) {
+            int first = i;
+            for (int j = 0; j < i && first == i; j++) {
+                if (lens[j] == lens[i] &&
+                    memcmp(pats[j], pats[i], lens[i]) == 0) {
+                    first = j;
+                }
+            }
+            int want = 0;
+            for (size_t k = 0; k + lens[i] <= len; k++) {
+                want += memcmp(text + k, pats[i], lens[i]) == 0;
+            }
+            errors += first == i && got[i] != want;
+        }
+        ac_destroy(&ac);
+    }
+    return errors;
+}
+
+/* small random dictionaries against one search per word */
+static int check_per_word(void)
+{
+    char text[200], buf[16][8];
+    char *words[16];
+    int want[16], got[16];
+    int errors = 0;
+
+    for (int r = 0; r < AC_TEST_ROUNDS; r++) {
+        int alphabet = 1 + rand() % 3;
+        int num = 1 + rand() % 16;
+        ac_t ac;
+        ac_init(&ac, 0);
+        for (int i = 0; i < num; i++) {
+            random_word(buf[i], 1 + rand() % 6, alphabet);
+            words[i] = buf[i];
+            ac_add(&ac, words[i], strlen(words[i]));
+        }
+        ac_build(&ac);
+        random_word(text, rand() % (sizeof(text) - 1), alphabet);
+        count_per_word(text, strlen(text), words, num, want);
+        memset(got, 0, sizeof(got));
+        ac_scan(&ac, text, strlen(text), ac_count_cb, got);
+        for (int i = 0; i < num; i++) {
+            /* duplicates are reported under the first id */
+            int first = i;
+            for (int j = 0; j < i; j++) {
+                if (strcmp(words[j], words[i]) == 0) {
+                    first = j;
+                    break;
+                }
+            }
+            if (first == i && got[i] != want[i]) {
+                errors++;
+            }
+            /* exact lookup walks the same table */
+            int s = 0;
+            for (int k = 0; words[i][k] != '\0'; k++) {
+                s = ac_step(&ac, s, words[i][k]);
+            }
+            if (ac_exact(&ac, s, strlen(words[i])) != first) {
+                errors++;
+            }
+        }
+        ac_destroy(&ac);
+    }
+
+    /* case folding */
+    ac_t ac;
+    ac_init(&ac, AC_ICASE);
+    ac_add(&ac, "Hit", 3);
+    ac_build(&ac);
+    if (ac_scan(&ac, "hit HIT hIt hot", 15, NULL, NULL) != 3) {
+        errors++;
+    }
+    ac_destroy(&ac);
+    return errors;
+}
+
+int test_aho_corasick(void)
+{
+    int errors = check_per_word() + check_all_bytes();
+    if (errors > 0) {
+        printf("aho_corasick: %d cases differ from per word search\n",
+               errors);
+    }
+
+    char *text = (char *)malloc(AC_TEXT_SIZE + 1);
+    random_word(text, AC_TEXT_SIZE, 26);
+
+    for (int num = 10; num <= 10000; num *= 10) {
+        char **words = (char **)malloc(sizeof(char *) * num);
+        int *want = (int *)calloc(num, sizeof(int));
+        int *got = (int *)calloc(num, sizeof(int));
+        ac_t ac;
+
+        /* short words so that matches actually happen */
+        ac_init(&ac, 0);
+        for (int i = 0; i < num; i++) {
+            words[i] = (char *)malloc(AC_WORD_LEN + 1);
+            random_word(words[i], 3 + rand() % (AC_WORD_LEN - 2), 26);
+            ac_add(&ac, words[i], strlen(words[i]));
+        }
+        uint64_t t0 = get_time_ns();
+        ac_build(&ac);
+        uint64_t t1 = get_time_ns();
+        size_t matches = ac_scan(&ac, text, AC_TEXT_SIZE, ac_count_cb, got);
+        uint64_t t2 = get_time_ns();
+        count_per_word(text, AC_TEXT_SIZE, words, num, want);
+        uint64_t t3 = get_time_ns();
+
+        /* repeated words count once, under their first id */
+        long total = 0;
+        for (int i = 0; i < num; i++) {
+            int s = 0;
+            for (int k = 0; words[i][k] != '\0'; k++) {
+                s = ac_step(&ac, s, words[i][k]);
+            }
+            if (ac_exact(&ac, s, strlen(words[i])) == i) {
+                total += want[i];
+            }
+        }
+
+        printf("%5d words: %zu states, build %.1f ms, scan %.1f ms, "
+               "per word %.1f ms, %zu matches%s\n",
+               num, (size_t)ac.num_states, (t1 - t0) / 1e6, (t2 - t1) / 1e6,
+               (t3 - t2) / 1e6, matches,
+               (long)matches == total ? "" : " MISMATCH");
+        errors += (long)matches != total;
+
+        ac_destroy(&ac);
+        for (int i = 0; i < num; i++) {
+            free(words[i]);
+        }
+        free(words);
+        free(want);
+        free(got);
+    }
+    free(text);
+    return errors > 0 ? -1 : 0;
+}
@@ -0,0 +1,161 @@
+/**
+ * @file test_arena.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief arena test, random allocations and marks checked for alignment
+ * and overlap, then per call scratch through malloc against an arena
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "arena.h"
+#include "test.h"
+
+#define AR_TEST_ROUNDS 200
+#define AR_TEST_LIVE 64
+#define AR_BENCH_CALLS 1000000
+#define AR_BENCH_ALLOCS 20
+
+typedef struct {
+    unsigned char *p;
+    size_t size;
+    unsigned char fill;
+} live_t;
+
+static int check_live(const live_t *live, int n)
+{
+    for (int i = 0; i < n; i++) {
+        for (size_t j = 0; j < live[i].size; j++) {
+            if (live[i].p[j] != live[i].fill) {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/* random allocations, marks and pops, every live block keeps its bytes */
+static int check_marks(void)
+{
+    live_t live[AR_TEST_LIVE];
+    arena_mark_t marks[AR_TEST_LIVE];
+    int mark_at[AR_TEST_LIVE];
+    char buf[512];
+    int errors = 0;
+
+    for (int r = 0; r < AR_TEST_ROUNDS; r++) {
+        arena_t a;
+        if (r % 2) {
+            arena_init(&a, 64 + rand() % 512, 0);
+        } else {
+            arena_init_buffer(&a, buf, sizeof(buf), 0);
+        }
+        int n = 0, nmarks = 0;
+        for (int step = 0; step < 500; step++) {
+            int op = rand() % 10;
+            if (op < 6 && n < AR_TEST_LIVE) {
+                size_t align = (size_t)1 << (rand() % 7);
+                size_t size = rand() % 4 ? rand() % 64 : rand() % 2000;
+                unsigned char *p =
+                    (unsigned char *)arena_alloc_aligned(&a, size, align);
+                if (p == NULL || ((uintptr_t)p & (align - 1)) != 0) {
+                    errors++;
+                    break;
+                }
+                live[n].p = p;
+                live[n].size = size;
+                live[n].fill = (unsigned char)rand();
+                memset(p, live[n].fill, size);
+                n++;
+            } else if (op < 8 && nmarks < AR_TEST_LIVE) {
+                marks[nmarks] = arena_mark(&a);
+                mark_at[nmarks++] = n;
+            } else if (nmarks > 0) {
+                /* everything after the mark is gone, the rest must stay */
+                nmarks--;
+                arena_pop(&a, marks[nmarks]);
+                n = mark_at[nmarks];
+            }
+            errors += check_live(live, n);
+        }
+        arena_destroy(&a);
+    }
+
+    /* a fixed buffer runs out instead of growing */
+    arena_t a;
+    arena_init_buffer(&a, buf, sizeof(buf), ARENA_NO_GROW);
+    if (arena_alloc(&a, 400) == NULL || arena_alloc(&a, 200) != NULL) {
+        errors++;
+    }
+    arena_destroy(&a);
+    return errors;
+}
+
+/* summaryRanges style, a handful of short strings per call */
+static size_t call_malloc(int seed)
+{
+    char *s[AR_BENCH_ALLOCS];
+    size_t len = 0;
+
+    for (int i = 0; i < AR_BENCH_ALLOCS; i++) {
+        s[i] = (char *)malloc(25);
+        memset(s[i], 'a' + (seed + i) % 26, 24);
+        len += s[i][i];
+    }
+    for (int i = 0; i < AR_BENCH_ALLOCS; i++) {
+        free(s[i]);
+    }
+    return len;
+}
+
+static size_t call_arena(arena_t *a, int seed)
+{
+    arena_mark_t m = arena_mark(a);
+    size_t len = 0;
+
+    for (int i = 0; i < AR_BENCH_ALLOCS; i++) {
+        char *s = (char *)arena_alloc_aligned(a, 25, 1);
+        memset(s, 'a' + (seed + i) % 26, 24);
+        len += s[i];
+    }
+    arena_pop(a, m);
+    return len;
+}
+
+int test_arena(void)
+{
+    int errors = check_marks();
+    if (errors > 0) {
+        printf("arena: %d steps lost or misplaced a block\n", errors);
+    }
+
+    size_t len_a = 0, len_b = 0;
+    uint64_t t0 = get_time_ns();
+    for (int i = 0; i < AR_BENCH_CALLS; i++) {
+        len_a += call_malloc(i);
+    }
+    uint64_t t1 = get_time_ns();
+    arena_t a;
+    char buf[1024];
+    arena_init_buffer(&a, buf, sizeof(buf), 0);
+    for (int i = 0; i < AR_BENCH_CALLS; i++) {
+        len_b += call_arena(&a, i);
+    }
+    arena_destroy(&a);
+    uint64_t t2 = get_time_ns();
+
+    printf("%d calls of %d strings%s\n", AR_BENCH_CALLS, AR_BENCH_ALLOCS,
+           len_a == len_b ? "" : " MISMATCH");
+    printf("  malloc/free: %.1f ns per call\n",
+           (double)(t1 - t0) / AR_BENCH_CALLS);
+    printf("  arena:       %.1f ns per call\n",
+           (double)(t2 - t1) / AR_BENCH_CALLS);
+    errors += len_a != len_b;
+    return errors > 0 ? -1 : 0;
+}
@@ -0,0 +1,208 @@
+/**
+ * @file test_bignum.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief bignum test, add, sub and mul in both radixes against digit by
+ * digit string arithmetic, then 100k digit sums against the per
+ * character loop with reversals
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "bignum.h"
+#include "test.h"
+
+#define BN_TEST_ROUNDS 1000
+#define BN_BENCH_DIGITS 100000
+#define BN_BENCH_REPEAT 20
+
+static void random_digits(char *s, size_t n, int base)
+{
+    for (size_t i = 0; i < n; i++) {
+        s[i] = (char)('0' + rand() % base);
+    }
+    /* long runs of the top digit make carries travel */
+    if (rand() % 2) {
+        size_t from = rand() % (n + 1);
+        memset(s + from, '0' + base - 1, n - from);
+    }
+    s[n] = '\0';
+}
+
+static const char *skip_zeros(const char *s)
+{
+    while (s[0] == '0' && s[1] != '\0') {
+        s++;
+    }
+    return s;
+}
+
+/* the addBinary way, reverse, add per character, reverse back */
+static char *char_add(const char *a, const char *b, int base)
+{
+    size_t la = strlen(a), lb = strlen(b);
+    size_t n = MAX(la, lb);
+    char *r = (char *)malloc(n + 2);
+    int carry = 0;
+    size_t len = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        carry += i < la ? a[la - 1 - i] - '0' : 0;
+        carry += i < lb ? b[lb - 1 - i] - '0' : 0;
+        r[len++] = (char)('0' + carry % base);
+        carry /= base;
+    }
+    if (carry) {
+        r[len++] = '1';
+    }
+    while (len > 1 && r[len - 1] == '0') {
+        len--;
+    }
+    for (size_t i = 0; i < len / 2; i++) {
+        char t = r[i];
+        r[i] = r[len - 1 - i];
+        r[len - 1 - i] = t;
+    }
+    r[len] = '\0';
+    return r;
+}
+
+static char *char_mul(const char *a, const char *b, int base)
+{
+    size_t la = strlen(a), lb = strlen(b);
+    int *acc = (int *)calloc(la + lb, sizeof(int));
+    char *r = (char *)malloc(la + lb + 1);
+
+    for (size_t i = 0; i < la; i++) {
+        for (size_t j = 0; j < lb; j++) {
+            acc[i + j + 1] += (a[i] - '0') * (b[j] - '0');
+        }
+    }
+    for (size_t k = la + lb - 1; k > 0; k--) {
+        acc[k - 1] += acc[k] / base;
+        acc[k] %= base;
+    }
+    for (size_t k = 0; k < la + lb; k++) {
+        r[k] = (char)('0' + acc[k]);
+    }
+    r[la + lb] = '\0';
+    free(acc);
+    memmove(r, skip_zeros(r), strlen(skip_zeros(r)) + 1);
+    return r;
+}
+
+/* decimal and binary operands against the per character add and multiply */
+static int check_digits(void)
+{
+    char a[400], b[400];
+    int errors = 0;
+
+    for (int r = 0; r < BN_TEST_ROUNDS; r++) {
+        int base = r % 2 ? 10 : 2;
+        bn_radix_t radix = base == 10 ? BN_DECIMAL : BN_BINARY;
+        size_t la = 1 + rand() % (r % 3 ? 40 : 300);
+        size_t lb = 1 + rand() % (r % 3 ? 40 : 300);
+        random_digits(a, la, base);
+        random_digits(b, lb, base);
+
+        bignum_t x, y, z;
+        bn_init(&x, radix);
+        bn_init(&y, radix);
+        bn_init(&z, radix);
+        bn_parse(&x, a, la);
+        bn_parse(&y, b, lb);
+
+        char *want = char_add(a, b, base);
+        bn_add(&z, &x, &y);
+        char *got = bn_to_string(&z);
+        errors += strcmp(want, got) != 0;
+        free(got);
+
+        /* (a + b) - b in place is a again */
+        bn_sub(&z, &z, &y);
+        got = bn_to_string(&z);
+        errors += strcmp(skip_zeros(a), got) != 0;
+        free(got);
+        errors += bn_cmp(&x, &y) < 0 && bn_sub(&z, &x, &y) != -1;
+
+        /* a + 1 */
+        char one[2] = "1";
+        free(want);
+        want = char_add(a, one, base);
+        bn_add_small(&x, 1);
+        got = bn_to_string(&x);
+        errors += strcmp(want, got) != 0;
+        free(got);
+        free(want);
+
+        if (la < 120 && lb < 120) {
+            bn_parse(&x, a, la);
+            want = char_mul(a, b, base);
+            bn_mul(&z, &x, &y);
+            got = bn_to_string(&z);
+            errors += strcmp(want, got) != 0;
+            free(got);
+            free(want);
+        }
+        bn_destroy(&x);
+        bn_destroy(&y);
+        bn_destroy(&z);
+    }
+    return errors;
+}
+
+int test_bignum(void)
+{
+    int errors = check_digits();
+    if (errors > 0) {
+        printf("bignum: %d results differ from per character math\n",
+               errors);
+    }
+
+    char *a = (char *)malloc(BN_BENCH_DIGITS + 1);
+    char *b = (char *)malloc(BN_BENCH_DIGITS + 1);
+    for (int base = 10; base >= 2; base -= 8) {
+        random_digits(a, BN_BENCH_DIGITS, base);
+        random_digits(b, BN_BENCH_DIGITS, base);
+        a[0] = b[0] = '1';
+        char *want = NULL, *got = NULL;
+
+        uint64_t t0 = get_time_ns();
+        for (int r = 0; r < BN_BENCH_REPEAT; r++) {
+            free(want);
+            want = char_add(a, b, base);
+        }
+        uint64_t t1 = get_time_ns();
+        for (int r = 0; r < BN_BENCH_REPEAT; r++) {
+            bignum_t x, y;
+            bn_init(&x, base == 10 ? BN_DECIMAL : BN_BINARY);
+            bn_init(&y, x.radix);
+            bn_parse(&x, a, BN_BENCH_DIGITS);
+            bn_parse(&y, b, BN_BENCH_DIGITS);
+            bn_add(&x, &x, &y);
+            free(got);
+            got = bn_to_string(&x);
+            bn_destroy(&x);
+            bn_destroy(&y);
+        }
+        uint64_t t2 = get_time_ns();
+        int diff = strcmp(want, got) != 0;
+        printf("%d digit base %d sum: per character %.1f us, "
+               "bignum parse+add+format %.1f us%s\n",
+               BN_BENCH_DIGITS, base, (t1 - t0) / 1e3 / BN_BENCH_REPEAT,
+               (t2 - t1) / 1e3 / BN_BENCH_REPEAT,
+               diff ? " MISMATCH" : "");
+        errors += diff;
+        free(want);
+        free(got);
+    }
+    free(a);
+    free(b);
+    return errors > 0 ? -1 : 0;
+}
@@ -0,0 +1,144 @@
+/**
+ * @file test_edit_distance.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief edit distance test, the three engines against a full table DP and
+ * a fuzzy lookup over a word list
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include "utils.h"
+#include "edit_distance.h"
+#include "test.h"
+
+#define ED_TEST_ROUNDS 3000
+#define ED_LONG_LEN 500
+#define ED_DICT_SIZE 200000
+#define ED_MAX 2
+
+/* full (n + 1) * (m + 1) table */
+static int full_table(const char *a, int n, const char *b, int m)
+{
+    int *d = (int *)malloc(sizeof(int) * (n + 1) * (m + 1));
+
+    for (int i = 0; i <= n; i++) {
+        for (int j = 0; j <= m; j++) {
+            if (i == 0 || j == 0) {
+                d[i * (m + 1) + j] = i + j;
+                continue;
+            }
+            int best = d[(i - 1) * (m + 1) + j - 1] + (a[i - 1] != b[j - 1]);
+            best = MIN(best, d[(i - 1) * (m + 1) + j] + 1);
+            best = MIN(best, d[i * (m + 1) + j - 1] + 1);
+            d[i * (m + 1) + j] = best;
+        }
+    }
+    int dist = d[n * (m + 1) + m];
+    free(d);
+    return dist;
+}
+
+static void random_word(char *s, int len, int alphabet)
+{
+    for (int i = 0; i < len; i++) {
+        s[i] = 'a' + rand() % alphabet;
+    }
+    s[len] = '\0';
+}
+
+/* every variant against the full table, lengths across 1 to 3 words */
+static int check_variants(void)
+{
+    char a[200], b[200];
+    int errors = 0;
+
+    for (int r = 0; r < ED_TEST_ROUNDS; r++) {
+        int n = rand() % 180, m = rand() % 180;
+        int alphabet = 1 + rand() % 4;
+        random_word(a, n, alphabet);
+        random_word(b, m, alphabet);
+        int want = full_table(a, n, b, m);
+        int k = rand() % 20;
+        if (edit_distance_dp(a, n, b, m) != want ||
+            edit_distance(a, n, b, m) != want ||
+            edit_distance_bounded(a, n, b, m, k) != MIN(want, k + 1)) {
+            errors++;
+        }
+        edit_pattern_t p;
+        edit_pattern_init(&p, a, n);
+        if (edit_pattern_distance(&p, b, m, k) != MIN(want, k + 1) ||
+            edit_pattern_distance(&p, b, m, INT_MAX) != want) {
+            errors++;
+        }
+        edit_pattern_destroy(&p);
+    }
+    return errors;
+}
+
+int test_edit_distance(void)
+{
+    int errors = check_variants();
+    if (errors > 0) {
+        printf("edit_distance: %d cases differ from the full table\n",
+               errors);
+    }
+
+    /* LeetCode limit */
+    char a[ED_LONG_LEN + 1], b[ED_LONG_LEN + 1];
+    random_word(a, ED_LONG_LEN, 26);
+    random_word(b, ED_LONG_LEN, 26);
+    uint64_t t0 = get_time_ns();
+    int d0 = edit_distance_dp(a, ED_LONG_LEN, b, ED_LONG_LEN);
+    uint64_t t1 = get_time_ns();
+    int d1 = edit_distance(a, ED_LONG_LEN, b, ED_LONG_LEN);
+    uint64_t t2 = get_time_ns();
+    printf("500 x 500: dp %d in %.1f us, bit-parallel %d in %.1f us\n", d0,
+           (t1 - t0) / 1e3, d1, (t2 - t1) / 1e3);
+    errors += d0 != d1;
+
+    /* words within ED_MAX edits of a query */
+    char *dict = (char *)malloc(ED_DICT_SIZE * 16);
+    int *lens = (int *)malloc(sizeof(int) * ED_DICT_SIZE);
+    for (int i = 0; i < ED_DICT_SIZE; i++) {
+        lens[i] = 4 + rand() % 10;
+        random_word(dict + i * 16, lens[i], 8);
+    }
+    const char *query = "abcdefgh";
+    int ql = strlen(query);
+    int hits[3] = {0};
+    t0 = get_time_ns();
+    for (int i = 0; i < ED_DICT_SIZE; i++) {
+        hits[0] += edit_distance_dp(query, ql, dict + i * 16, lens[i]) <=
+                   ED_MAX;
+    }
+    t1 = get_time_ns();
+    for (int i = 0; i < ED_DICT_SIZE; i++) {
+        hits[1] += edit_distance_bounded(query, ql, dict + i * 16, lens[i],
+                                         ED_MAX) <= ED_MAX;
+    }
+    t2 = get_time_ns();
+    edit_pattern_t p;
+    edit_pattern_init(&p, query, ql);
+    for (int i = 0; i < ED_DICT_SIZE; i++) {
+        hits[2] +=
+            edit_pattern_distance(&p, dict + i * 16, lens[i], ED_MAX) <= ED_MAX;
+    }
+    uint64_t t3 = get_time_ns();
+    edit_pattern_destroy(&p);
+    printf("%d words, max %d: dp %d in %.1f ms, banded %d in %.1f ms, "
+           "compiled %d in %.1f ms\n",
+           ED_DICT_SIZE, ED_MAX, hits[0], (t1 - t0) / 1e6, hits[1],
+           (t2 - t1) / 1e6, hits[2], (t3 - t2) / 1e6);
+    errors += hits[0] != hits[1] || hits[1] != hits[2];
+
+    free(lens);
+    free(dict);
+    return errors > 0 ? -1 : 0;
+}
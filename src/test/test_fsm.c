@@ -1,10 +1,15 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
 #include <pthread.h>
 #include <unistd.h>
 #include <time.h>
 
+#include "utils.h"
+#include "fsm.h"
+#include "timer_wheel.h"
+
 #define UNIV_WAY
 #if defined(UNIV_WAY)
 // Define the states of the traffic light
@@ -298,12 +303,25 @@ void timerCallback(void)
     printf("Timer event occurred\n");
 }
 
-// Function to simulate a timer event
+static void timerExpired(tw_timer_t *timer, void *arg)
+{
+    *(bool *)arg = true;
+}
+
+// Function to simulate a timer event, the thread sleeps on a timer wheel
+// until the timeout instead of spinning on time(NULL)
 void startTimer(int seconds, Event event, void (*callback)())
 {
-    time_t startTime = time(NULL);
-    while (difftime(time(NULL), startTime) < seconds) {
+    timer_wheel_t tw;
+    tw_timer_t timer;
+    bool expired = false;
+
+    timer_wheel_init(&tw, 10000); // 10ms ticks
+    tw_timer_init(&timer, timerExpired, &expired);
+    timer_wheel_add(&tw, &timer, (uint64_t)seconds * 100);
+    while (!expired) {
         // Waiting for the timer to expire
+        timer_wheel_sleep(&tw, UINT64_MAX);
     }
     if (event == EVENT_TIMEOUT) {
         if (callback) {
@@ -334,3 +352,155 @@ int test_state(void)
 
     return 0;
 }
+
+/*------------------------------------------------------------------*/
+// Table driven door and traffic light on the generic engine in fsm.h
+#define FSM_BENCH_EVENTS 10000000
+#define FSM_BENCH_MACHINES 100000
+
+typedef enum { TL_EVENT_TIMER, TL_EVENT_RESET, TL_EVENT_NUM } TrafficLightEvent;
+
+static void doorOpened(void *ctx, fsm_state_t from, fsm_event_t event,
+                       fsm_state_t to)
+{
+    if (ctx) {
+        (*(long *)ctx)++;
+    }
+}
+
+static int buildDoorTable(fsm_def_t *def)
+{
+    if (fsm_def_init(def, 2, 2) != 0) {
+        return -1;
+    }
+    int opened = fsm_def_action(def, doorOpened);
+    fsm_def_add(def, DOOR_CLOSED, EVENT_OPEN_DOOR, DOOR_OPEN, opened);
+    fsm_def_add(def, DOOR_OPEN, EVENT_CLOSE_DOOR, DOOR_CLOSED, FSM_NO_ACTION);
+    return 0;
+}
+
+static int buildTrafficLightTable(fsm_def_t *def)
+{
+    if (fsm_def_init(def, 3, TL_EVENT_NUM) != 0) {
+        return -1;
+    }
+    fsm_def_add(def, RED, TL_EVENT_TIMER, YELLOW, FSM_NO_ACTION);
+    fsm_def_add(def, YELLOW, TL_EVENT_TIMER, GREEN, FSM_NO_ACTION);
+    fsm_def_add(def, GREEN, TL_EVENT_TIMER, RED, FSM_NO_ACTION);
+    fsm_def_add(def, YELLOW, TL_EVENT_RESET, RED, FSM_NO_ACTION);
+    fsm_def_add(def, GREEN, TL_EVENT_RESET, RED, FSM_NO_ACTION);
+    return 0;
+}
+
+static void printRate(const char *name, uint64_t ns, long events, int state)
+{
+    printf("%-28s %8.2f Mevents/s (%.2f ns/event) state=%d\n", name,
+           events * 1000.0 / ns, (double)ns / events, state);
+}
+
+int test_fsm_table(void)
+{
+    fsm_def_t door, light;
+    fsm_t fsm;
+    long opened = 0, switch_opened = 0;
+    uint64_t start;
+    int n = FSM_BENCH_EVENTS;
+    int errors = 0;
+
+    if (buildDoorTable(&door) != 0 || buildTrafficLightTable(&light) != 0) {
+        return -1;
+    }
+
+    fsm_event_t *events = (fsm_event_t *)malloc(sizeof(fsm_event_t) * n);
+    if (events == NULL) {
+        printf("Memory allocation failed.\n");
+        fsm_def_destroy(&door);
+        fsm_def_destroy(&light);
+        return -1;
+    }
+    for (int i = 0; i < n; i++) {
+        events[i] = rand() & 1;
+    }
+
+    /* door: switch statement vs table */
+    DoorState doorState = DOOR_CLOSED;
+    start = get_time_ns();
+    for (int i = 0; i < n; i++) {
+        DoorState next = transition(doorState, (DoorEvent)events[i]);
+        switch_opened += doorState == DOOR_CLOSED && next == DOOR_OPEN;
+        doorState = next;
+    }
+    printRate("door switch", get_time_ns() - start, n, doorState);
+
+    fsm_init(&fsm, &door, DOOR_CLOSED, &opened);
+    start = get_time_ns();
+    for (int i = 0; i < n; i++) {
+        fsm_dispatch(&fsm, events[i]);
+    }
+    printRate("door table", get_time_ns() - start, n, fsm.state);
+    printf("door opened %ld times\n", opened);
+    errors += fsm.state != doorState || opened != switch_opened;
+
+    /* traffic light: mostly timer ticks with the odd reset */
+    for (int i = 0; i < n; i++) {
+        events[i] = (rand() % 16 == 0) ? TL_EVENT_RESET : TL_EVENT_TIMER;
+    }
+#if defined(UNIV_WAY)
+    TrafficLightState lightState = RED;
+    start = get_time_ns();
+    for (int i = 0; i < n; i++) {
+        lightState = events[i] == TL_EVENT_RESET ? RED : updateState(lightState);
+    }
+    printRate("traffic light switch", get_time_ns() - start, n, lightState);
+#endif
+
+    fsm_init(&fsm, &light, RED, NULL);
+    start = get_time_ns();
+    for (int i = 0; i < n; i++) {
+        fsm_dispatch(&fsm, events[i]);
+    }
+    printRate("traffic light table", get_time_ns() - start, n, fsm.state);
+#if defined(UNIV_WAY)
+    errors += fsm.state != lightState;
+#endif
+
+    /* many lights, one event each per round, states kept as a flat array */
+    int machines = FSM_BENCH_MACHINES;
+    int rounds = n / machines;
+    fsm_state_t *states = (fsm_state_t *)calloc(machines, sizeof(fsm_state_t));
+    if (states == NULL) {
+        printf("Memory allocation failed.\n");
+        free(events);
+        fsm_def_destroy(&door);
+        fsm_def_destroy(&light);
+        return -1;
+    }
+    start = get_time_ns();
+    for (int r = 0; r < rounds; r++) {
+        fsm_dispatch_batch(&light, states, &events[r * machines], NULL,
+                           machines);
+    }
+    printRate("traffic light batch", get_time_ns() - start,
+              (long)rounds * machines, states[0]);
+
+    /* one more round against a separate dispatch per machine */
+    fsm_state_t *want = (fsm_state_t *)malloc(sizeof(fsm_state_t) * machines);
+    if (want == NULL) {
+        printf("Memory allocation failed.\n");
+        errors++;
+    } else {
+        for (int i = 0; i < machines; i++) {
+            fsm_init(&fsm, &light, states[i], NULL);
+            want[i] = fsm_dispatch(&fsm, events[i]);
+        }
+        fsm_dispatch_batch(&light, states, events, NULL, machines);
+        errors += memcmp(want, states, sizeof(fsm_state_t) * machines) != 0;
+        free(want);
+    }
+
+    free(states);
+    free(events);
+    fsm_def_destroy(&door);
+    fsm_def_destroy(&light);
+    return errors > 0 ? -1 : 0;
+}
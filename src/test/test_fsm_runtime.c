@@ -0,0 +1,108 @@
+/**
+ * @file test_fsm_runtime.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief fsm runtime test, a ring of traffic lights passing timer events
+ * to their neighbours across the worker pool
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "utils.h"
+#include "fsm_runtime.h"
+#include "test.h"
+
+#define RT_TEST_LIGHTS 1000000
+#define RT_TEST_HOPS 4 /* events each seed message travels */
+#define RT_TEST_WORKERS 4
+
+enum { RT_RED, RT_YELLOW, RT_GREEN };
+enum { RT_EVENT_TIMER, RT_EVENT_NUM };
+
+typedef struct {
+    fsm_actor_t actor;
+    int hops; /* budget left for the next forward */
+    int handled;
+} rt_light_t;
+
+static rt_light_t *rt_lights;
+
+/* forward the tick to the next light until the budget runs out */
+static void rt_forward(void *ctx, fsm_state_t from, fsm_event_t event,
+                       fsm_state_t to)
+{
+    rt_light_t *light = (rt_light_t *)ctx;
+    light->handled++;
+    if (light->hops > 0) {
+        light->hops--;
+        rt_light_t *next = &rt_lights[(light - rt_lights + 1) % RT_TEST_LIGHTS];
+        fsm_actor_send(&next->actor, RT_EVENT_TIMER);
+    }
+}
+
+int test_fsm_runtime(void)
+{
+    fsm_def_t def;
+    fsm_runtime_t *rt = fsm_runtime_create(RT_TEST_WORKERS);
+
+    if (rt == NULL || fsm_def_init(&def, 3, RT_EVENT_NUM) != 0) {
+        return -1;
+    }
+    int forward = fsm_def_action(&def, rt_forward);
+    fsm_def_add(&def, RT_RED, RT_EVENT_TIMER, RT_YELLOW, forward);
+    fsm_def_add(&def, RT_YELLOW, RT_EVENT_TIMER, RT_GREEN, forward);
+    fsm_def_add(&def, RT_GREEN, RT_EVENT_TIMER, RT_RED, forward);
+
+    rt_lights = (rt_light_t *)malloc(sizeof(rt_light_t) * RT_TEST_LIGHTS);
+    for (int i = 0; i < RT_TEST_LIGHTS; i++) {
+        fsm_actor_init(&rt_lights[i].actor, rt, &def, RT_RED, &rt_lights[i]);
+        rt_lights[i].hops = RT_TEST_HOPS;
+        rt_lights[i].handled = 0;
+    }
+
+    uint64_t start = get_time_ns();
+    for (int i = 0; i < RT_TEST_LIGHTS; i++) {
+        fsm_actor_send(&rt_lights[i].actor, RT_EVENT_TIMER);
+    }
+    fsm_runtime_wait_idle(rt);
+    uint64_t cost = get_time_ns() - start;
+
+    /* every light gets its seed plus one forward per hop of its neighbour */
+    long total = 0;
+    int wrong = 0;
+    for (int i = 0; i < RT_TEST_LIGHTS; i++) {
+        int handled = rt_lights[i].handled;
+        total += handled;
+        if (handled != RT_TEST_HOPS + 1 ||
+            fsm_actor_state(&rt_lights[i].actor) != handled % 3) {
+            wrong++;
+        }
+    }
+    printf("fsm runtime: %d workers, %ld events, %d wrong, %.1f M events/s\n",
+           RT_TEST_WORKERS, total, wrong, total * 1e3 / cost);
+
+    fsm_runtime_destroy(rt);
+
+    /* destroy with events still queued, they are dropped and freed */
+    rt = fsm_runtime_create(RT_TEST_WORKERS);
+    if (rt == NULL) {
+        fsm_def_destroy(&def);
+        free(rt_lights);
+        return -1;
+    }
+    for (int i = 0; i < RT_TEST_LIGHTS; i++) {
+        fsm_actor_init(&rt_lights[i].actor, rt, &def, RT_RED, &rt_lights[i]);
+        rt_lights[i].hops = 0;
+    }
+    for (int i = 0; i < RT_TEST_LIGHTS; i++) {
+        fsm_actor_send(&rt_lights[i].actor, RT_EVENT_TIMER);
+    }
+    fsm_runtime_destroy(rt);
+    fsm_def_destroy(&def);
+    free(rt_lights);
+    return wrong ? -1 : 0;
+}
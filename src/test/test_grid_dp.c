@@ -0,0 +1,167 @@
+/**
+ * @file test_grid_dp.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief grid DP test, rolling row and tiled waves against the full table
+ * on random grids across tile edges, then a large grid swept both ways
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "utils.h"
+#include "grid_dp.h"
+#include "test.h"
+
+#define GD_TEST_ROUNDS 36
+#define GD_BENCH_SIZE 3000
+
+static int **grid_alloc(int rows, int cols)
+{
+    int **g = (int **)malloc(sizeof(int *) * rows);
+    int *cells = (int *)malloc(sizeof(int) * rows * cols);
+    for (int i = 0; i < rows; i++) {
+        g[i] = cells + (size_t)i * cols;
+    }
+    return g;
+}
+
+static void grid_free(int **g)
+{
+    free(g[0]);
+    free(g);
+}
+
+static void grid_fill(int **g, int rows, int cols, int max)
+{
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            g[i][j] = rand() % (max + 1);
+        }
+    }
+}
+
+/* the whole rows x cols table, as the old code kept it */
+static int64_t full_min_sum(int **g, int rows, int cols, int64_t *dp)
+{
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            int64_t best = i == 0 && j == 0 ? 0 : INT64_MAX;
+            if (i > 0) {
+                best = MIN(best, dp[(size_t)(i - 1) * cols + j]);
+            }
+            if (j > 0) {
+                best = MIN(best, dp[(size_t)i * cols + j - 1]);
+            }
+            dp[(size_t)i * cols + j] = best + g[i][j];
+        }
+    }
+    return dp[(size_t)rows * cols - 1];
+}
+
+static uint64_t full_count(int **g, int rows, int cols, uint64_t *dp)
+{
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            uint64_t n = i == 0 && j == 0 ? 1 : 0;
+            if (i > 0) {
+                n += dp[(size_t)(i - 1) * cols + j];
+            }
+            if (j > 0) {
+                n += dp[(size_t)i * cols + j - 1];
+            }
+            dp[(size_t)i * cols + j] = g[i][j] ? 0 : n;
+        }
+    }
+    return dp[(size_t)rows * cols - 1];
+}
+
+/* random grids, some big enough to tile, against the full tables */
+static int check_grids(void)
+{
+    int errors = 0;
+
+    for (int r = 0; r < GD_TEST_ROUNDS; r++) {
+        /* every few rounds big enough for several tiles and threads */
+        int big = r % 6 == 0;
+        int rows = 1 + rand() % (big ? 1500 : 600);
+        int cols = 1 + rand() % (big ? 1500 : 600);
+        if (big) {
+            rows += 1024;
+            cols += 1024;
+        }
+        int **g = grid_alloc(rows, cols);
+        int64_t *dp = (int64_t *)malloc(sizeof(int64_t) * rows * cols);
+
+        grid_fill(g, rows, cols, r % 2 ? 200 : 9);
+        g[0][0] -= r % 3; /* a negative cell now and then */
+        int64_t s1 = 0, s4 = 0;
+        errors += grid_dp_min_path_sum(g, rows, cols, 1, &s1) != 0;
+        errors += grid_dp_min_path_sum(g, rows, cols, 4, &s4) != 0;
+        int64_t want = full_min_sum(g, rows, cols, dp);
+        errors += s1 != want || s4 != want;
+
+        /* sparse obstacles, the start itself blocked once in a while */
+        for (int i = 0; i < rows; i++) {
+            for (int j = 0; j < cols; j++) {
+                g[i][j] = rand() % 100 < 3 + r % 10;
+            }
+        }
+        uint64_t c1 = 0, c4 = 0;
+        errors += grid_dp_count_paths(g, rows, cols, 1, &c1) != 0;
+        errors += grid_dp_count_paths(g, rows, cols, 4, &c4) != 0;
+        uint64_t cw = full_count(g, rows, cols, (uint64_t *)dp);
+        errors += c1 != cw || c4 != cw;
+
+        free(dp);
+        grid_free(g);
+    }
+
+    /* closed form against the open grid table, up to 34 x 34 */
+    for (int m = 1; m <= 34; m++) {
+        for (int n = 1; n <= 34; n++) {
+            int **g = grid_alloc(m, n);
+            uint64_t dp[34 * 34];
+            grid_fill(g, m, n, 0);
+            errors += grid_dp_unique_paths(m, n) != full_count(g, m, n, dp);
+            grid_free(g);
+        }
+    }
+    errors += grid_dp_unique_paths(3, 7) != 28;
+    errors += grid_dp_unique_paths(0, 7) != 0;
+    return errors;
+}
+
+int test_grid_dp(void)
+{
+    int errors = check_grids();
+    if (errors > 0) {
+        printf("grid_dp: %d grids differ from the full table\n", errors);
+    }
+
+    int **g = grid_alloc(GD_BENCH_SIZE, GD_BENCH_SIZE);
+    int64_t *dp = (int64_t *)malloc(sizeof(int64_t) * GD_BENCH_SIZE *
+                                    GD_BENCH_SIZE);
+    grid_fill(g, GD_BENCH_SIZE, GD_BENCH_SIZE, 200);
+
+    uint64_t t0 = get_time_ns();
+    int64_t s0 = full_min_sum(g, GD_BENCH_SIZE, GD_BENCH_SIZE, dp);
+    uint64_t t1 = get_time_ns();
+    int64_t s1 = 0;
+    grid_dp_min_path_sum(g, GD_BENCH_SIZE, GD_BENCH_SIZE, 1, &s1);
+    uint64_t t2 = get_time_ns();
+    int64_t s2 = 0;
+    grid_dp_min_path_sum(g, GD_BENCH_SIZE, GD_BENCH_SIZE, 0, &s2);
+    uint64_t t3 = get_time_ns();
+    printf("%dx%d min path sum: full table %.1f ms, rolling row %.1f ms, "
+           "all CPUs %.1f ms%s\n",
+           GD_BENCH_SIZE, GD_BENCH_SIZE, (t1 - t0) / 1e6, (t2 - t1) / 1e6,
+           (t3 - t2) / 1e6, s0 == s1 && s0 == s2 ? "" : " MISMATCH");
+    errors += s0 != s1 || s0 != s2;
+    free(dp);
+    grid_free(g);
+    return errors > 0 ? -1 : 0;
+}
@@ -0,0 +1,132 @@
+/**
+ * @file test_histogram.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief histogram test, counts, differences and count order against
+ * plain loops on random strings, then one table against four on 16M bytes
+ * of random text and of a single repeated byte
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "histogram.h"
+#include "test.h"
+
+#define HI_TEST_ROUNDS 2000
+#define HI_TEST_SIZE 500
+#define HI_BENCH_SIZE (16 << 20)
+
+static void fill(char *s, size_t n, int kind)
+{
+    for (size_t i = 0; i < n; i++) {
+        switch (kind) {
+        case 0: /* every byte value */
+            s[i] = (char)(rand() & 0xFF);
+            break;
+        case 1:
+            s[i] = (char)('a' + rand() % 26);
+            break;
+        case 2: /* long runs of few letters */
+            s[i] = i > 0 && rand() % 16 ? s[i - 1] : (char)('a' + rand() % 3);
+            break;
+        default:
+            s[i] = 'z';
+            break;
+        }
+    }
+}
+
+/* every helper on short strings against one plain table */
+static int check_tables(void)
+{
+    char a[HI_TEST_SIZE], b[HI_TEST_SIZE], out[HI_TEST_SIZE];
+    uint32_t h[HIST_SIZE], g[HIST_SIZE], ref[HIST_SIZE];
+    int32_t d[HIST_SIZE];
+    int errors = 0;
+
+    for (int r = 0; r < HI_TEST_ROUNDS; r++) {
+        size_t n = rand() % HI_TEST_SIZE;
+        int kind = r % 4;
+        fill(a, n, kind);
+        memcpy(b, a, n);
+        /* a shuffle of a, then sometimes one byte changed */
+        for (size_t i = n; i > 1; i--) {
+            size_t j = rand() % i;
+            SWAP(char, &b[i - 1], &b[j]);
+        }
+        int changed = n > 0 && rand() % 2;
+        if (changed) {
+            b[rand() % n] ^= 1 + rand() % 0x7F;
+        }
+
+        memset(ref, 0, sizeof(ref));
+        for (size_t i = 0; i < n; i++) {
+            ref[(unsigned char)a[i]]++;
+        }
+        hist_count(a, n, h);
+        errors += memcmp(h, ref, sizeof(ref)) != 0;
+
+        hist_count(b, n, g);
+        hist_count_diff(a, b, n, d);
+        int first = -1;
+        for (int c = 0; c < HIST_SIZE; c++) {
+            errors += d[c] != (int32_t)(h[c] - g[c]);
+            first = first < 0 && h[c] > g[c] ? c : first;
+        }
+        errors += hist_all_zero(d) == changed;
+        errors += hist_first_positive(d) != first;
+        errors += !hist_covers(h, h);
+        errors += hist_covers(h, g) == changed;
+
+        size_t len = hist_sort_by_count(h, out);
+        errors += len != n;
+        for (size_t i = 1; i < len; i++) {
+            unsigned char x = out[i - 1], y = out[i];
+            /* runs are whole and ordered by count then byte */
+            errors += x != y && (h[x] < h[y] || (h[x] == h[y] && x > y));
+            errors += x != y && memchr(out + i, x, len - i) != NULL;
+        }
+    }
+    return errors;
+}
+
+static int bench(const char *s, const char *name)
+{
+    uint32_t one[HIST_SIZE], four[HIST_SIZE];
+
+    uint64_t t0 = get_time_ns();
+    memset(one, 0, sizeof(one));
+    for (size_t i = 0; i < HI_BENCH_SIZE; i++) {
+        one[(unsigned char)s[i]]++;
+    }
+    uint64_t t1 = get_time_ns();
+    hist_count(s, HI_BENCH_SIZE, four);
+    uint64_t t2 = get_time_ns();
+    int diff = memcmp(one, four, sizeof(one)) != 0;
+    printf("count %d bytes of %s: one table %.2f ms, four tables %.2f ms%s\n",
+           HI_BENCH_SIZE, name, (t1 - t0) / 1e6, (t2 - t1) / 1e6,
+           diff ? " MISMATCH" : "");
+    return diff;
+}
+
+int test_histogram(void)
+{
+    int errors = check_tables();
+    if (errors > 0) {
+        printf("histogram: %d cases differ from one plain table\n", errors);
+    }
+
+    char *s = (char *)malloc(HI_BENCH_SIZE);
+    fill(s, HI_BENCH_SIZE, 1);
+    errors += bench(s, "random letters");
+    fill(s, HI_BENCH_SIZE, 3);
+    errors += bench(s, "one letter");
+    free(s);
+    return errors > 0 ? -1 : 0;
+}
@@ -0,0 +1,176 @@
+/**
+ * @file test_jagged.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief jagged array test, export round trip and a subsets style result
+ * built with a malloc per row against the two allocation layout
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "jagged.h"
+#include "test.h"
+
+#define JG_TEST_ROUNDS 200
+#define JG_BENCH_BITS 20
+
+/* random rows pushed or written in place against separate copies */
+static int check_rows(void)
+{
+    int errors = 0;
+
+    for (int r = 0; r < JG_TEST_ROUNDS; r++) {
+        int rows = rand() % 50;
+        int *want_len = (int *)malloc(sizeof(int) * rows + 1);
+        int **want = (int **)malloc(sizeof(int *) * rows + 1);
+        jagged_t jg;
+
+        /* no hints half of the time, so the buffers have to grow */
+        if (r % 2) {
+            jagged_init(&jg, rows, 0);
+        } else {
+            memset(&jg, 0, sizeof(jg));
+        }
+        for (int i = 0; i < rows; i++) {
+            want_len[i] = rand() % 40;
+            want[i] = (int *)malloc(sizeof(int) * want_len[i] + 1);
+            for (int j = 0; j < want_len[i]; j++) {
+                want[i][j] = rand();
+            }
+            if (i % 3) {
+                jagged_push(&jg, want[i], want_len[i]);
+            } else {
+                int *row = jagged_begin_row(&jg, want_len[i] + 5);
+                memcpy(row, want[i], sizeof(int) * want_len[i]);
+                jagged_end_row(&jg, want_len[i]);
+            }
+        }
+        int size;
+        int *sizes;
+        int **got = jagged_export(&jg, &size, &sizes);
+        if (got == NULL || size != rows) {
+            errors++;
+        } else {
+            for (int i = 0; i < rows; i++) {
+                if (sizes[i] != want_len[i] ||
+                    memcmp(got[i], want[i], sizeof(int) * want_len[i]) != 0) {
+                    errors++;
+                    break;
+                }
+            }
+        }
+        jagged_destroy(&jg);
+        free(got);
+        free(sizes);
+        for (int i = 0; i < rows; i++) {
+            free(want[i]);
+        }
+        free(want);
+        free(want_len);
+    }
+    return errors;
+}
+
+/* the layout the demo functions used before */
+static int **subsets_rows(const int *nums, int n, int *size, int **sizes)
+{
+    int total = 1 << n;
+    int **ans = (int **)malloc(sizeof(int *) * total);
+    int t[32];
+
+    *sizes = (int *)malloc(sizeof(int) * total);
+    *size = total;
+    for (int mask = 0; mask < total; mask++) {
+        int len = 0;
+        for (int i = 0; i < n; i++) {
+            if (mask & (1 << i)) {
+                t[len++] = nums[i];
+            }
+        }
+        ans[mask] = (int *)malloc(sizeof(int) * len + 1);
+        memcpy(ans[mask], t, sizeof(int) * len);
+        (*sizes)[mask] = len;
+    }
+    return ans;
+}
+
+static int **subsets_jagged(const int *nums, int n, int *size, int **sizes)
+{
+    int total = 1 << n;
+    jagged_t jg;
+
+    jagged_init(&jg, total, (size_t)n * total / 2);
+    for (int mask = 0; mask < total; mask++) {
+        int *row = jagged_begin_row(&jg, n);
+        int len = 0;
+        for (int i = 0; i < n; i++) {
+            if (mask & (1 << i)) {
+                row[len++] = nums[i];
+            }
+        }
+        jagged_end_row(&jg, len);
+    }
+    return jagged_export(&jg, size, sizes);
+}
+
+static int64_t walk(int **rows, int size, const int *sizes)
+{
+    int64_t sum = 0;
+
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < sizes[i]; j++) {
+            sum += rows[i][j];
+        }
+    }
+    return sum;
+}
+
+int test_jagged(void)
+{
+    int errors = check_rows();
+    if (errors > 0) {
+        printf("jagged: %d exports differ from the rows pushed\n", errors);
+    }
+
+    int nums[JG_BENCH_BITS];
+    for (int i = 0; i < JG_BENCH_BITS; i++) {
+        nums[i] = i + 1;
+    }
+
+    int size_a, size_b;
+    int *sizes_a, *sizes_b;
+    uint64_t t0 = get_time_ns();
+    int **a = subsets_rows(nums, JG_BENCH_BITS, &size_a, &sizes_a);
+    uint64_t t1 = get_time_ns();
+    int64_t sum_a = walk(a, size_a, sizes_a);
+    uint64_t t2 = get_time_ns();
+    for (int i = 0; i < size_a; i++) {
+        free(a[i]);
+    }
+    free(a);
+    free(sizes_a);
+    uint64_t t3 = get_time_ns();
+
+    int **b = subsets_jagged(nums, JG_BENCH_BITS, &size_b, &sizes_b);
+    uint64_t t4 = get_time_ns();
+    int64_t sum_b = walk(b, size_b, sizes_b);
+    uint64_t t5 = get_time_ns();
+    free(b);
+    free(sizes_b);
+    uint64_t t6 = get_time_ns();
+
+    printf("subsets of %d, %d rows%s\n", JG_BENCH_BITS, size_a,
+           sum_a == sum_b ? "" : " MISMATCH");
+    printf("  malloc per row: build %.1f ms, walk %.1f ms, free %.1f ms\n",
+           (t1 - t0) / 1e6, (t2 - t1) / 1e6, (t3 - t2) / 1e6);
+    printf("  jagged:         build %.1f ms, walk %.1f ms, free %.1f ms\n",
+           (t4 - t3) / 1e6, (t5 - t4) / 1e6, (t6 - t5) / 1e6);
+    errors += size_a != size_b || sum_a != sum_b;
+    return errors > 0 ? -1 : 0;
+}
@@ -0,0 +1,166 @@
+/**
+ * @file test_ksum.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief k-sum test, tuples against brute force and the sequential and
+ * threaded search on large inputs
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "utils.h"
+#include "ksum.h"
+#include "test.h"
+
+#define KS_TEST_ROUNDS 500
+#define KS_BIG_SIZE 40000
+
+static int int_cmp(const void *a, const void *b)
+{
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/* all index combinations, kept if the sum fits and the tuple is new */
+static void brute_force(const int *a, int n, int k, int64_t target,
+                        ksum_result_t *out)
+{
+    int idx[KSUM_MAX_K];
+    int t[KSUM_MAX_K];
+
+    for (int i = 0; i < k; i++) {
+        idx[i] = i;
+    }
+    while (n >= k) {
+        int64_t sum = 0;
+        for (int i = 0; i < k; i++) {
+            t[i] = a[idx[i]];
+            sum += t[i];
+        }
+        bool seen = sum != target;
+        for (size_t r = 0; r < out->count && !seen; r++) {
+            seen = memcmp(out->data + r * k, t, sizeof(int) * k) == 0;
+        }
+        if (!seen) {
+            if (out->count == out->cap) {
+                out->cap = out->cap ? out->cap * 2 : 16;
+                out->data =
+                    (int *)realloc(out->data, sizeof(int) * k * out->cap);
+            }
+            memcpy(out->data + out->count * k, t, sizeof(int) * k);
+            out->count++;
+        }
+        int i = k - 1;
+        while (i >= 0 && idx[i] == n - k + i) {
+            i--;
+        }
+        if (i < 0) {
+            break;
+        }
+        idx[i]++;
+        for (int j = i + 1; j < k; j++) {
+            idx[j] = idx[j - 1] + 1;
+        }
+    }
+}
+
+static bool same(const ksum_result_t *a, const ksum_result_t *b)
+{
+    return a->count == b->count &&
+           (a->count == 0 ||
+            memcmp(a->data, b->data, sizeof(int) * a->k * a->count) == 0);
+}
+
+/* small random arrays against every index combination */
+static int check_small(void)
+{
+    int a[24];
+    int errors = 0;
+
+    for (int r = 0; r < KS_TEST_ROUNDS; r++) {
+        int n = rand() % 24;
+        int k = 2 + rand() % 3;
+        int range = 1 + rand() % 20;
+        for (int i = 0; i < n; i++) {
+            a[i] = rand() % range - range / 2;
+        }
+        qsort(a, n, sizeof(int), int_cmp);
+        int64_t target = rand() % 9 - 4;
+
+        ksum_result_t want, got, par;
+        ksum_result_init(&want, k);
+        ksum_result_init(&got, k);
+        ksum_result_init(&par, k);
+        brute_force(a, n, k, target, &want);
+        ksum_find(a, n, k, target, &got);
+        ksum_find_parallel(a, n, k, target, &par, 3);
+        if (!same(&want, &got) || !same(&want, &par)) {
+            errors++;
+        }
+        ksum_result_destroy(&want);
+        ksum_result_destroy(&got);
+        ksum_result_destroy(&par);
+
+        /* closest, against every triple */
+        if (n >= 3) {
+            int64_t best = (int64_t)a[0] + a[1] + a[2];
+            for (int i = 0; i < n; i++) {
+                for (int j = i + 1; j < n; j++) {
+                    for (int l = j + 1; l < n; l++) {
+                        int64_t s = (int64_t)a[i] + a[j] + a[l];
+                        int64_t d = llabs(s - target);
+                        int64_t bd = llabs(best - target);
+                        if (d < bd || (d == bd && s < best)) {
+                            best = s;
+                        }
+                    }
+                }
+            }
+            if (ksum_closest3(a, n, target) != best) {
+                errors++;
+            }
+        }
+    }
+    return errors;
+}
+
+int test_ksum(void)
+{
+    int errors = check_small();
+    if (errors > 0) {
+        printf("ksum: %d cases differ from brute force\n", errors);
+    }
+
+    /* past the 32767 the short indices of threeSum could reach */
+    int *a = (int *)malloc(sizeof(int) * KS_BIG_SIZE);
+    for (int i = 0; i < KS_BIG_SIZE; i++) {
+        a[i] = rand() % 200001 - 100000;
+    }
+    qsort(a, KS_BIG_SIZE, sizeof(int), int_cmp);
+
+    int threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    ksum_result_t seq, par;
+    ksum_result_init(&seq, 3);
+    ksum_result_init(&par, 3);
+    uint64_t t0 = get_time_ns();
+    ksum_find(a, KS_BIG_SIZE, 3, 0, &seq);
+    uint64_t t1 = get_time_ns();
+    ksum_find_parallel(a, KS_BIG_SIZE, 3, 0, &par, MAX(threads, 2));
+    uint64_t t2 = get_time_ns();
+    printf("3-sum n=%d: %zu triplets, %.1f MB buffer, sequential %.0f ms, "
+           "%d threads %.0f ms%s\n",
+           KS_BIG_SIZE, seq.count, seq.cap * 3 * sizeof(int) / 1048576.0,
+           (t1 - t0) / 1e6, MAX(threads, 2), (t2 - t1) / 1e6,
+           same(&seq, &par) ? "" : " MISMATCH");
+    errors += !same(&seq, &par);
+    ksum_result_destroy(&seq);
+    ksum_result_destroy(&par);
+    free(a);
+    return errors > 0 ? -1 : 0;
+}
@@ -0,0 +1,141 @@
+/**
+ * @file test_kth_select.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief k-th selection test, every rank against a merged copy and the
+ * time of a median query over large shards
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "kth_select.h"
+#include "test.h"
+
+#define KS_TEST_ROUNDS 2000
+#define KS_SHARDS 8
+#define KS_SHARD_SIZE (1 << 20)
+
+static int int_cmp(const void *a, const void *b)
+{
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+static void random_sorted(int *a, size_t n, int range)
+{
+    for (size_t i = 0; i < n; i++) {
+        a[i] = rand() % range - range / 2;
+    }
+    qsort(a, n, sizeof(int), int_cmp);
+}
+
+/* up to four short sorted arrays against sorting them together */
+static int check_small(void)
+{
+    int a[4][40], merged[160];
+    const int *arrays[4] = {a[0], a[1], a[2], a[3]};
+    size_t sizes[4];
+    int errors = 0;
+
+    for (int r = 0; r < KS_TEST_ROUNDS; r++) {
+        int range = 1 + rand() % 50;
+        size_t total = 0;
+        for (int i = 0; i < 4; i++) {
+            sizes[i] = rand() % 40;
+            random_sorted(a[i], sizes[i], range);
+            memcpy(merged + total, a[i], sizeof(int) * sizes[i]);
+            total += sizes[i];
+        }
+        qsort(merged, total, sizeof(int), int_cmp);
+
+        /* two arrays */
+        int two[80];
+        size_t n2 = sizes[0] + sizes[1];
+        memcpy(two, a[0], sizeof(int) * sizes[0]);
+        memcpy(two + sizes[0], a[1], sizeof(int) * sizes[1]);
+        qsort(two, n2, sizeof(int), int_cmp);
+        for (size_t k = 0; k < n2; k++) {
+            if (kth_of_two(a[0], sizes[0], a[1], sizes[1], k) != two[k]) {
+                errors++;
+            }
+        }
+        if (n2 > 0) {
+            double want = n2 % 2 ? two[n2 / 2]
+                                 : (two[n2 / 2 - 1] + two[n2 / 2]) / 2.0;
+            if (median_of_two(a[0], sizes[0], a[1], sizes[1]) != want) {
+                errors++;
+            }
+        }
+
+        int value;
+        for (size_t k = 0; k < total; k++) {
+            if (kth_of_many(arrays, sizes, 4, k, &value) != 0 ||
+                value != merged[k]) {
+                errors++;
+            }
+        }
+        if (kth_of_many(arrays, sizes, 4, total, &value) != -1) {
+            errors++;
+        }
+    }
+    return errors;
+}
+
+int test_kth_select(void)
+{
+    int errors = check_small();
+    if (errors > 0) {
+        printf("kth_select: %d cases differ from a sorted merge\n", errors);
+    }
+
+    int *shards[KS_SHARDS];
+    size_t sizes[KS_SHARDS];
+    for (int i = 0; i < KS_SHARDS; i++) {
+        shards[i] = (int *)malloc(sizeof(int) * KS_SHARD_SIZE);
+        sizes[i] = KS_SHARD_SIZE;
+        random_sorted(shards[i], KS_SHARD_SIZE, INT_MAX);
+    }
+
+    /* merging is what the old findMedianSortedArrays amounted to */
+    uint64_t t0 = get_time_ns();
+    int *merged = (int *)malloc(sizeof(int) * 2 * KS_SHARD_SIZE);
+    size_t i = 0, j = 0, n = 0;
+    while (i < KS_SHARD_SIZE || j < KS_SHARD_SIZE) {
+        if (j == KS_SHARD_SIZE ||
+            (i < KS_SHARD_SIZE && shards[0][i] <= shards[1][j])) {
+            merged[n++] = shards[0][i++];
+        } else {
+            merged[n++] = shards[1][j++];
+        }
+    }
+    double want = ((int64_t)merged[n / 2 - 1] + merged[n / 2]) / 2.0;
+    uint64_t t1 = get_time_ns();
+    double got = median_of_two(shards[0], KS_SHARD_SIZE, shards[1],
+                               KS_SHARD_SIZE);
+    uint64_t t2 = get_time_ns();
+    printf("median of 2 x %d: merge %.2f ms, partition %.2f us%s\n",
+           KS_SHARD_SIZE, (t1 - t0) / 1e6, (t2 - t1) / 1e3,
+           want == got ? "" : " MISMATCH");
+    errors += want != got;
+    free(merged);
+
+    /* p99 over all shards */
+    uint64_t k = (uint64_t)KS_SHARDS * KS_SHARD_SIZE * 99 / 100;
+    int p99;
+    t0 = get_time_ns();
+    kth_of_many((const int *const *)shards, sizes, KS_SHARDS, k, &p99);
+    t1 = get_time_ns();
+    printf("p99 of %d x %d: %d in %.2f us\n", KS_SHARDS, KS_SHARD_SIZE, p99,
+           (t1 - t0) / 1e3);
+
+    for (int s = 0; s < KS_SHARDS; s++) {
+        free(shards[s]);
+    }
+    return errors > 0 ? -1 : 0;
+}
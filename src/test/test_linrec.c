@@ -0,0 +1,171 @@
+/**
+ * @file test_linrec.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief linear recurrence test, random recurrences of every order against
+ * stepping them term by term, then fibonacci far out against the loop
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "utils.h"
+#include "linrec.h"
+#include "test.h"
+
+#define LR_TEST_ROUNDS 300
+#define LR_TEST_TERMS 300
+#define LR_BENCH_INDEX 10000000ULL
+#define LR_BENCH_MOD 1000000007ULL
+
+static uint64_t rand64(void)
+{
+    return ((uint64_t)rand() << 62) ^ ((uint64_t)rand() << 31) ^ rand();
+}
+
+static uint64_t pick_mod(int r)
+{
+    switch (r % 4) {
+    case 0:
+        return 0;
+    case 1:
+        return 1 + rand() % 100;
+    case 2:
+        return LR_BENCH_MOD;
+    default:
+        return 1 + (rand64() >> 1) % ((1ULL << 63) - 1);
+    }
+}
+
+/* bit by bit, nothing wider than 64 bits */
+static uint64_t slow_mul_mod(uint64_t a, uint64_t b, uint64_t mod)
+{
+    if (mod == 0) {
+        return a * b;
+    }
+    uint64_t r = 0;
+    for (int i = 63; i >= 0; i--) {
+        r = (r + r) % mod;
+        if ((b >> i) & 1) {
+            r = (r + a) % mod;
+        }
+    }
+    return r;
+}
+
+/* a(0) .. a(LR_TEST_TERMS - 1) the slow way, every term from the last k */
+static int check_recurrence(const linrec_t *lr)
+{
+    uint64_t a[LR_TEST_TERMS];
+    uint64_t mod = lr->mod;
+    int errors = 0;
+
+    for (int n = 0; n < LR_TEST_TERMS; n++) {
+        if (n < lr->k) {
+            a[n] = lr->init[n];
+        } else {
+            uint64_t s = 0;
+            for (int j = 0; j < lr->k; j++) {
+                uint64_t t = slow_mul_mod(lr->coef[j], a[n - 1 - j], mod);
+                s = mod ? (s + t) % mod : s + t;
+            }
+            a[n] = s;
+        }
+        errors += linrec_nth(lr, n) != a[n];
+    }
+    return errors;
+}
+
+/* random recurrences term by term, then the fib and tribonacci tables */
+static int check_terms(void)
+{
+    uint64_t coef[LINREC_MAX_ORDER], init[LINREC_MAX_ORDER];
+    linrec_t lr;
+    int errors = 0;
+
+    for (int r = 0; r < LR_TEST_ROUNDS; r++) {
+        int k = 1 + rand() % LINREC_MAX_ORDER;
+        uint64_t mod = pick_mod(r);
+        for (int i = 0; i < k; i++) {
+            coef[i] = r % 3 ? rand64() : rand() % 3;
+            init[i] = rand64();
+        }
+        if (linrec_init(&lr, k, coef, init, mod) != 0) {
+            errors++;
+            continue;
+        }
+        errors += check_recurrence(&lr);
+    }
+
+    /* the tables hand over to the matrix power at their ends */
+    uint64_t f0 = 0, f1 = 1, t0 = 0, t1 = 1, t2 = 1, m0 = 0, m1 = 1;
+    for (uint64_t n = 0; n < LR_TEST_TERMS; n++) {
+        errors += linrec_fib(n, 0) != f0;
+        errors += linrec_fib(n, LR_BENCH_MOD) != m0;
+        errors += linrec_tribonacci(n, 0) != t0;
+        uint64_t f = f0 + f1, m = (m0 + m1) % LR_BENCH_MOD;
+        uint64_t t = t0 + t1 + t2;
+        f0 = f1;
+        f1 = f;
+        m0 = m1;
+        m1 = m;
+        t0 = t1;
+        t1 = t2;
+        t2 = t;
+    }
+
+    errors += linrec_init(&lr, 0, coef, init, 0) == 0;
+    errors += linrec_init(&lr, LINREC_MAX_ORDER + 1, coef, init, 0) == 0;
+    errors += linrec_init(&lr, 2, coef, init, 1ULL << 63) == 0;
+    return errors;
+}
+
+int test_linrec(void)
+{
+    int errors = check_terms();
+    if (errors > 0) {
+        printf("linrec: %d terms differ from stepping the recurrence\n",
+               errors);
+    }
+
+    uint64_t t0 = get_time_ns();
+    uint64_t a = 0, b = 1;
+    for (uint64_t i = 0; i < LR_BENCH_INDEX; i++) {
+        uint64_t c = (a + b) % LR_BENCH_MOD;
+        a = b;
+        b = c;
+    }
+    uint64_t t1 = get_time_ns();
+    uint64_t f = linrec_fib(LR_BENCH_INDEX, LR_BENCH_MOD);
+    uint64_t t2 = get_time_ns();
+    printf("F(%llu) mod %llu: loop %.2f ms, matrix power %.2f us%s\n",
+           (unsigned long long)LR_BENCH_INDEX,
+           (unsigned long long)LR_BENCH_MOD, (t1 - t0) / 1e6,
+           (t2 - t1) / 1e3, a == f ? "" : " MISMATCH");
+    errors += a != f;
+
+    /* the climbStairs range, table against the dp array */
+    volatile uint64_t dp_sum = 0, table_sum = 0;
+    t0 = get_time_ns();
+    for (int r = 0; r < 100000; r++) {
+        int n = 1 + r % 45;
+        uint64_t dp[46];
+        dp[0] = dp[1] = 1;
+        for (int i = 2; i <= n; i++) {
+            dp[i] = dp[i - 1] + dp[i - 2];
+        }
+        dp_sum += dp[n];
+    }
+    t1 = get_time_ns();
+    for (int r = 0; r < 100000; r++) {
+        table_sum += linrec_fib(2 + r % 45, 0);
+    }
+    t2 = get_time_ns();
+    printf("100000 climbStairs(n <= 45): dp %.2f ms, table %.2f ms\n",
+           (t1 - t0) / 1e6, (t2 - t1) / 1e6);
+    errors += dp_sum != table_sum;
+    return errors > 0 ? -1 : 0;
+}
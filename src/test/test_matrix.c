@@ -0,0 +1,268 @@
+/**
+ * @file test_matrix.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief matrix test, every transform against an index loop on random
+ * shapes and row strides, the "int **" views both ways, then 8k x 8k
+ * benchmarks against the loops the demos had
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "matrix.h"
+#include "test.h"
+
+#define MX_TEST_ROUNDS 500
+#define MX_TEST_SIZE 100
+#define MX_BENCH_SIZE 8192
+
+static void fill(int *a, size_t rows, size_t cols, size_t ld, int zeroes)
+{
+    for (size_t i = 0; i < rows; i++) {
+        for (size_t j = 0; j < cols; j++) {
+            a[i * ld + j] = rand() % zeroes == 0 ? 0 : 1 + rand() % 1000;
+        }
+    }
+}
+
+/* the LeetCode zigzag, one anti-diagonal at a time */
+static void brute_diagonal(const int *a, size_t rows, size_t cols, size_t ld,
+                           int *out)
+{
+    size_t k = 0;
+
+    for (size_t d = 0; d + 1 < rows + cols; d++) {
+        for (size_t t = 0; t <= d; t++) {
+            size_t r = d % 2 ? t : d - t;
+            if (r < rows && d - r < cols) {
+                out[k++] = a[r * ld + d - r];
+            }
+        }
+    }
+}
+
+static int check_square(size_t n, size_t ld)
+{
+    int *a = (int *)malloc(sizeof(int) * (n * ld + 1));
+    int *b = (int *)malloc(sizeof(int) * (n * ld + 1));
+    int errors = 0;
+
+    fill(a, n, n, ld, 50);
+    memcpy(b, a, sizeof(int) * n * ld);
+    matrix_transpose(b, n, ld);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            errors += b[i * ld + j] != a[j * ld + i];
+        }
+    }
+
+    memcpy(b, a, sizeof(int) * n * ld);
+    matrix_rotate(b, n, ld);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            errors += b[i * ld + j] != a[(n - 1 - j) * ld + i];
+        }
+    }
+    free(a);
+    free(b);
+    return errors;
+}
+
+static int check_rect(size_t rows, size_t cols, size_t ld)
+{
+    size_t size = rows * ld + 1;
+    int *a = (int *)malloc(sizeof(int) * size);
+    int *b = (int *)malloc(sizeof(int) * size);
+    int *o = (int *)malloc(sizeof(int) * size);
+    int *p = (int *)malloc(sizeof(int) * size);
+    int errors = 0;
+
+    fill(a, rows, cols, ld, 1 + rand() % 200);
+    memcpy(b, a, sizeof(int) * rows * ld);
+    matrix_set_zeroes(b, rows, cols, ld);
+    for (size_t i = 0; i < rows; i++) {
+        for (size_t j = 0; j < cols; j++) {
+            bool zero = false;
+            for (size_t k = 0; k < cols; k++) {
+                zero |= a[i * ld + k] == 0;
+            }
+            for (size_t k = 0; k < rows; k++) {
+                zero |= a[k * ld + j] == 0;
+            }
+            errors += b[i * ld + j] != (zero ? 0 : a[i * ld + j]);
+        }
+    }
+
+    memcpy(b, a, sizeof(int) * rows * ld);
+    matrix_flip_rows(b, rows, cols, ld);
+    for (size_t i = 0; i < rows; i++) {
+        errors += memcmp(b + i * ld, a + (rows - 1 - i) * ld,
+                         sizeof(int) * cols) != 0;
+    }
+
+    brute_diagonal(a, rows, cols, ld, o);
+    errors += matrix_diagonal_order(a, rows, cols, ld, p) != rows * cols;
+    errors += memcmp(o, p, sizeof(int) * rows * cols) != 0;
+    free(a);
+    free(b);
+    free(o);
+    free(p);
+    return errors;
+}
+
+static int check_views(void)
+{
+    int errors = 0;
+    int block[6 * 7];
+    int *rows[6];
+    matrix_view_t v;
+
+    /* evenly spaced rows with a gap are used in place */
+    for (int i = 0; i < 6; i++) {
+        rows[i] = block + i * 7;
+    }
+    errors += matrix_view_open(&v, rows, 6, 5) != 0;
+    errors += v.data != block || v.ld != 7 || v.src != NULL;
+    matrix_view_close(&v, true);
+
+    /* scattered rows are packed and written back */
+    for (int i = 0; i < 6; i++) {
+        rows[i] = block + (5 - i) * 7;
+        for (int j = 0; j < 5; j++) {
+            rows[i][j] = i * 5 + j;
+        }
+    }
+    errors += matrix_view_open(&v, rows, 6, 5) != 0;
+    errors += v.src != rows || v.ld != 5;
+    for (int k = 0; k < 30; k++) {
+        errors += v.data[k] != k;
+        v.data[k] = -k;
+    }
+    matrix_view_close(&v, true);
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < 5; j++) {
+            errors += rows[i][j] != -(i * 5 + j);
+        }
+    }
+    return errors;
+}
+
+/* random shapes and row gaps against index loops, then the views */
+static int check_transforms(void)
+{
+    int errors = check_views();
+
+    for (int r = 0; r < MX_TEST_ROUNDS; r++) {
+        size_t rows = rand() % MX_TEST_SIZE + 1;
+        size_t cols = rand() % MX_TEST_SIZE + 1;
+        size_t gap = rand() % 3 ? 0 : rand() % 9;
+        errors += check_square(rows, rows + gap);
+        errors += check_rect(rows, cols, cols + gap);
+    }
+    /* more than a few levels of halving, off the multiples of 8 */
+    errors += check_square(517, 520);
+    errors += check_rect(300, 701, 701);
+    return errors;
+}
+
+int test_matrix(void)
+{
+    int errors = check_transforms();
+    if (errors > 0) {
+        printf("matrix: %d cells differ from the index loops\n", errors);
+    }
+
+    const size_t n = MX_BENCH_SIZE;
+    int *a = (int *)malloc(sizeof(int) * n * n);
+    int **m = (int **)malloc(sizeof(int *) * n);
+    int *out = (int *)malloc(sizeof(int) * n * n);
+    for (size_t i = 0; i < n; i++) {
+        m[i] = a + i * n;
+    }
+    fill(a, n, n, n, 1 << 24);
+
+    /* the demos' rotate, flip then swap across the diagonal by index */
+    int keep = a[n * 3 + 5];
+    uint64_t t0 = get_time_ns();
+    for (size_t i = 0; i < n / 2; i++) {
+        for (size_t j = 0; j < n; j++) {
+            SWAP(int, &m[i][j], &m[n - 1 - i][j]);
+        }
+    }
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < i; j++) {
+            SWAP(int, &m[i][j], &m[j][i]);
+        }
+    }
+    uint64_t t1 = get_time_ns();
+    /* three more turns bring it back, the first one is timed */
+    uint64_t t2 = get_time_ns();
+    matrix_rotate(a, n, n);
+    uint64_t t3 = get_time_ns();
+    matrix_rotate(a, n, n);
+    matrix_rotate(a, n, n);
+    printf("rotate %zux%zu: index loops %.2f ms, blocked %.2f ms%s\n", n, n,
+           (t1 - t0) / 1e6, (t3 - t2) / 1e6,
+           keep == a[n * 3 + 5] ? "" : " MISMATCH");
+    errors += keep != a[n * 3 + 5];
+
+    t0 = get_time_ns();
+    size_t k = 0;
+    for (size_t d = 0; d + 1 < 2 * n; d++) {
+        size_t lo = d < n ? 0 : d - n + 1, hi = MIN(d, n - 1);
+        for (size_t t = lo; t <= hi; t++) {
+            size_t r = d % 2 ? t : lo + hi - t;
+            out[k++] = m[r][d - r];
+        }
+    }
+    t1 = get_time_ns();
+    int last = out[n * n / 2];
+    matrix_diagonal_order(a, n, n, n, out);
+    t2 = get_time_ns();
+    printf("diagonal order %zux%zu: index loops %.2f ms, tiled %.2f ms%s\n",
+           n, n, (t1 - t0) / 1e6, (t2 - t1) / 1e6,
+           last == out[n * n / 2] ? "" : " MISMATCH");
+    errors += last != out[n * n / 2];
+
+    /* a handful of zeroes, the record arrays against the marker row */
+    for (int z = 0; z < 16; z++) {
+        a[(rand() % n) * n + rand() % n] = 0;
+    }
+    int *copy = out;
+    memcpy(copy, a, sizeof(int) * n * n);
+    t0 = get_time_ns();
+    char *zr = (char *)calloc(n, 1), *zc = (char *)calloc(n, 1);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            if (m[i][j] == 0) {
+                zr[i] = zc[j] = 1;
+            }
+        }
+    }
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            if (zr[i] || zc[j]) {
+                m[i][j] = 0;
+            }
+        }
+    }
+    t1 = get_time_ns();
+    matrix_set_zeroes(copy, n, n, n);
+    t2 = get_time_ns();
+    int diff = memcmp(a, copy, sizeof(int) * n * n) != 0;
+    printf("set zeroes %zux%zu: record arrays %.2f ms, marker row %.2f ms%s\n",
+           n, n, (t1 - t0) / 1e6, (t2 - t1) / 1e6, diff ? " MISMATCH" : "");
+    errors += diff;
+    free(zr);
+    free(zc);
+    free(a);
+    free(m);
+    free(out);
+    return errors > 0 ? -1 : 0;
+}
@@ -0,0 +1,195 @@
+/**
+ * @file test_merge.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief merge test, the three merges against qsort, then the shifting
+ * insert of merge_stored_array, a branchy scalar merge and qsort as the
+ * baselines
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "merge.h"
+#include "test.h"
+
+#define MG_TEST_ROUNDS 500
+#define MG_SHIFT_SIZE 20000
+#define MG_TWO_SIZE (1 << 22)
+#define MG_K_RUNS 64
+
+static int int_cmp(const void *a, const void *b)
+{
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+static void fill_sorted(int *a, size_t n, int range)
+{
+    for (size_t i = 0; i < n; i++) {
+        a[i] = rand() % range - range / 2;
+    }
+    qsort(a, n, sizeof(int), int_cmp);
+}
+
+/* one to nine random runs, each merge against qsort */
+static int check_runs(void)
+{
+    int errors = 0;
+
+    for (int r = 0; r < MG_TEST_ROUNDS; r++) {
+        int k = 1 + rand() % 9;
+        int range = rand() % 2 ? 10 : 1 << 30;
+        size_t lens[9], total = 0;
+        int *runs[9];
+        for (int s = 0; s < k; s++) {
+            lens[s] = rand() % 4 ? rand() % 40 : rand() % 300;
+            runs[s] = (int *)malloc(sizeof(int) * lens[s] + 1);
+            fill_sorted(runs[s], lens[s], range);
+            total += lens[s];
+        }
+        int *want = (int *)malloc(sizeof(int) * total + 1);
+        int *got = (int *)malloc(sizeof(int) * total + 1);
+        for (int s = 0, o = 0; s < k; s++) {
+            memcpy(want + o, runs[s], sizeof(int) * lens[s]);
+            o += lens[s];
+        }
+        qsort(want, total, sizeof(int), int_cmp);
+
+        merge_k((const int *const *)runs, lens, k, got);
+        errors += memcmp(want, got, sizeof(int) * total) != 0;
+
+        size_t two = lens[0] + (k > 1 ? lens[1] : 0);
+        int *pair = (int *)malloc(sizeof(int) * two + 1);
+        memcpy(pair, runs[0], sizeof(int) * lens[0]);
+        if (k > 1) {
+            memcpy(pair + lens[0], runs[1], sizeof(int) * lens[1]);
+        }
+        qsort(pair, two, sizeof(int), int_cmp);
+        merge_two(runs[0], lens[0], runs[k > 1], k > 1 ? lens[1] : 0, got);
+        errors += memcmp(pair, got, sizeof(int) * two) != 0;
+        memcpy(got, runs[0], sizeof(int) * lens[0]);
+        merge_backward(got, lens[0], runs[k > 1], k > 1 ? lens[1] : 0);
+        errors += memcmp(pair, got, sizeof(int) * two) != 0;
+
+        free(pair);
+        free(want);
+        free(got);
+        for (int s = 0; s < k; s++) {
+            free(runs[s]);
+        }
+    }
+    return errors;
+}
+
+/* merge_stored_array before, each element of b shifts the tail of a */
+static void merge_shift(int *a, int m, const int *b, int n)
+{
+    int i = 0;
+
+    for (int j = 0; j < n; j++) {
+        while (i < m && a[i] <= b[j]) {
+            i++;
+        }
+        memmove(a + i + 1, a + i, sizeof(int) * (m - i));
+        a[i++] = b[j];
+        m++;
+    }
+}
+
+static void branchy_merge(const int *a, size_t m, const int *b, size_t n,
+                          int *out)
+{
+    size_t i = 0, j = 0, o = 0;
+
+    while (i < m && j < n) {
+        if (a[i] <= b[j]) {
+            out[o++] = a[i++];
+        } else {
+            out[o++] = b[j++];
+        }
+    }
+    while (i < m) {
+        out[o++] = a[i++];
+    }
+    while (j < n) {
+        out[o++] = b[j++];
+    }
+}
+
+int test_merge(void)
+{
+    int errors = check_runs();
+    if (errors > 0) {
+        printf("merge: %d merges differ from qsort\n", errors);
+    }
+
+    /* shifting insert against the backward merge */
+    int *a = (int *)malloc(sizeof(int) * 2 * MG_SHIFT_SIZE);
+    int *c = (int *)malloc(sizeof(int) * 2 * MG_SHIFT_SIZE);
+    int *b = (int *)malloc(sizeof(int) * MG_SHIFT_SIZE);
+    fill_sorted(a, MG_SHIFT_SIZE, 1 << 30);
+    fill_sorted(b, MG_SHIFT_SIZE, 1 << 30);
+    memcpy(c, a, sizeof(int) * MG_SHIFT_SIZE);
+    uint64_t t0 = get_time_ns();
+    merge_shift(a, MG_SHIFT_SIZE, b, MG_SHIFT_SIZE);
+    uint64_t t1 = get_time_ns();
+    merge_backward(c, MG_SHIFT_SIZE, b, MG_SHIFT_SIZE);
+    uint64_t t2 = get_time_ns();
+    int diff = memcmp(a, c, sizeof(int) * 2 * MG_SHIFT_SIZE) != 0;
+    printf("%d + %d in place: shifting %.2f ms, backward %.3f ms%s\n",
+           MG_SHIFT_SIZE, MG_SHIFT_SIZE, (t1 - t0) / 1e6, (t2 - t1) / 1e6,
+           diff ? " MISMATCH" : "");
+    errors += diff;
+    free(a);
+    free(b);
+    free(c);
+
+    /* two large runs */
+    a = (int *)malloc(sizeof(int) * MG_TWO_SIZE);
+    b = (int *)malloc(sizeof(int) * MG_TWO_SIZE);
+    c = (int *)malloc(sizeof(int) * 2 * MG_TWO_SIZE);
+    int *d = (int *)malloc(sizeof(int) * 2 * MG_TWO_SIZE);
+    fill_sorted(a, MG_TWO_SIZE, 1 << 30);
+    fill_sorted(b, MG_TWO_SIZE, 1 << 30);
+    t0 = get_time_ns();
+    branchy_merge(a, MG_TWO_SIZE, b, MG_TWO_SIZE, c);
+    t1 = get_time_ns();
+    merge_two(a, MG_TWO_SIZE, b, MG_TWO_SIZE, d);
+    t2 = get_time_ns();
+    diff = memcmp(c, d, sizeof(int) * 2 * MG_TWO_SIZE) != 0;
+    printf("%d + %d: branchy %.2f ms, merge_two %.2f ms%s\n", MG_TWO_SIZE,
+           MG_TWO_SIZE, (t1 - t0) / 1e6, (t2 - t1) / 1e6,
+           diff ? " MISMATCH" : "");
+    errors += diff;
+    free(a);
+    free(b);
+
+    /* k runs carved out of c, against sorting the concatenation */
+    const int *runs[MG_K_RUNS];
+    size_t lens[MG_K_RUNS];
+    size_t per = 2 * (size_t)MG_TWO_SIZE / MG_K_RUNS;
+    for (int s = 0; s < MG_K_RUNS; s++) {
+        fill_sorted(c + s * per, per, 1 << 30);
+        runs[s] = c + s * per;
+        lens[s] = per;
+    }
+    t0 = get_time_ns();
+    merge_k(runs, lens, MG_K_RUNS, d);
+    t1 = get_time_ns();
+    qsort(c, 2 * MG_TWO_SIZE, sizeof(int), int_cmp);
+    t2 = get_time_ns();
+    diff = memcmp(c, d, sizeof(int) * 2 * MG_TWO_SIZE) != 0;
+    printf("%d runs of %zu: loser tree %.2f ms, qsort %.2f ms%s\n",
+           MG_K_RUNS, per, (t1 - t0) / 1e6, (t2 - t1) / 1e6,
+           diff ? " MISMATCH" : "");
+    errors += diff;
+    free(c);
+    free(d);
+    return errors > 0 ? -1 : 0;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file test_palindrome.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief palindrome test, Manacher against brute force and the timing of
+ * checking every candidate against one linear pass
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "palindrome.h"
+#include "test.h"
+
+#define PA_TEST_ROUNDS 5000
+#define PA_CANDIDATE_SIZE 1000
+#define PA_BIG_SIZE (4 << 20)
+
+static bool brute_is_palindrome(const char *s, int l, int r)
+{
+    while (l < r) {
+        if (s[l++] != s[r--]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* longest first, leftmost first, as longestPalindrome did */
+static int brute_longest(const char *s, int n, int *start)
+{
+    for (int len = n; len > 0; len--) {
+        for (int j = 0; j + len <= n; j++) {
+            if (brute_is_palindrome(s, j, j + len - 1)) {
+                *start = j;
+                return len;
+            }
+        }
+    }
+    *start = 0;
+    return 0;
+}
+
+/* short strings over one to three letters against the brute force */
+static int check_small(void)
+{
+    char s[64], t[64];
+    int errors = 0;
+
+    for (int r = 0; r < PA_TEST_ROUNDS; r++) {
+        int n = rand() % sizeof(s);
+        int alphabet = 1 + rand() % 3;
+        for (int i = 0; i < n; i++) {
+            s[i] = 'a' + rand() % alphabet;
+        }
+
+        int want_start;
+        int want = brute_longest(s, n, &want_start);
+        size_t start, len;
+        palin_longest(s, n, &start, &len);
+        if ((int)len != want || (int)start != want_start) {
+            errors++;
+        }
+
+        uint64_t want_count = 0, count;
+        for (int i = 0; i < n; i++) {
+            for (int j = i; j < n; j++) {
+                want_count += brute_is_palindrome(s, i, j);
+            }
+        }
+        palin_count(s, n, &count);
+        if (count != want_count) {
+            errors++;
+        }
+
+        bool want_valid = n < 3;
+        for (int d = 0; d < n && !want_valid; d++) {
+            memcpy(t, s, d);
+            memcpy(t + d, s + d + 1, n - d - 1);
+            want_valid = brute_is_palindrome(t, 0, n - 2);
+        }
+        if (palin_valid_delete_one(s, n) != want_valid) {
+            errors++;
+        }
+    }
+    return errors;
+}
+
+int test_palindrome(void)
+{
+    int errors = check_small();
+    if (errors > 0) {
+        printf("palindrome: %d cases differ from brute force\n", errors);
+    }
+
+    /* LeetCode limit, two letters keep short palindromes everywhere */
+    char *s = (char *)malloc(PA_BIG_SIZE);
+    for (int i = 0; i < PA_CANDIDATE_SIZE; i++) {
+        s[i] = 'a' + rand() % 2;
+    }
+    uint64_t t0 = get_time_ns();
+    int start_a;
+    int a = brute_longest(s, PA_CANDIDATE_SIZE, &start_a);
+    uint64_t t1 = get_time_ns();
+    size_t start_b, b;
+    palin_longest(s, PA_CANDIDATE_SIZE, &start_b, &b);
+    uint64_t t2 = get_time_ns();
+    printf("%d chars: candidates %d in %.2f ms, manacher %d in %.3f ms\n",
+           PA_CANDIDATE_SIZE, a, (t1 - t0) / 1e6, (int)b, (t2 - t1) / 1e6);
+    errors += (size_t)a != b || (size_t)start_a != start_b;
+
+    /* megabytes, all equal bytes is the worst case for expanding */
+    for (int round = 0; round < 2; round++) {
+        for (int i = 0; i < PA_BIG_SIZE; i++) {
+            s[i] = round == 0 ? 'a' : 'a' + rand() % 2;
+        }
+        uint64_t count;
+        t0 = get_time_ns();
+        palin_longest(s, PA_BIG_SIZE, &start_b, &b);
+        palin_count(s, PA_BIG_SIZE, &count);
+        bool valid = palin_valid_delete_one(s, PA_BIG_SIZE);
+        t1 = get_time_ns();
+        printf("%d MB %s: longest %zu, count %llu, valid %d in %.1f ms\n",
+               PA_BIG_SIZE >> 20, round == 0 ? "aaaa" : "abba", b,
+               (unsigned long long)count, valid, (t1 - t0) / 1e6);
+        if (round == 0) {
+            const uint64_t n = PA_BIG_SIZE;
+            errors += b != n || count != n * (n + 1) / 2 || !valid;
+        }
+    }
+    free(s);
+    return errors > 0 ? -1 : 0;
+}
@@ -0,0 +1,128 @@
+/**
+ * @file test_period.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief periodicity test, border, Z, period and rotation against brute
+ * force on small alphabets, then the quadratic checks on long inputs
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "period.h"
+#include "test.h"
+
+#define PD_TEST_ROUNDS 3000
+#define PD_BENCH_SIZE 100000
+
+static size_t brute_period(const char *s, size_t n)
+{
+    for (size_t p = 1; p < n; p++) {
+        if (memcmp(s, s + p, n - p) == 0) {
+            return p;
+        }
+    }
+    return n;
+}
+
+/* every rotation compared in full */
+static bool brute_rotation(const char *a, const char *b, size_t n)
+{
+    for (size_t r = 0; r < n; r++) {
+        if (memcmp(a, b + r, n - r) == 0 && memcmp(a + n - r, b, r) == 0) {
+            return true;
+        }
+    }
+    return n == 0;
+}
+
+/* short strings, some with a repeated unit, against the brute force */
+static int check_small(void)
+{
+    char a[64], b[64];
+    size_t pi[64], z[64];
+    int errors = 0;
+
+    for (int r = 0; r < PD_TEST_ROUNDS; r++) {
+        size_t n = rand() % 40;
+        int alphabet = 1 + rand() % 3;
+        /* a repeated unit half of the time, to hit real periods */
+        size_t unit = 1 + rand() % 6;
+        for (size_t i = 0; i < n; i++) {
+            a[i] = r % 2 && i >= unit ? a[i - unit] :
+                                        (char)('a' + rand() % alphabet);
+        }
+        period_prefix(a, n, pi);
+        period_z(a, n, z);
+        for (size_t i = 0; i < n; i++) {
+            size_t k = i;
+            while (k > 0 && memcmp(a, a + i + 1 - k, k) != 0) {
+                k--;
+            }
+            errors += pi[i] != k;
+            k = 0;
+            while (i + k < n && a[k] == a[i + k]) {
+                k++;
+            }
+            errors += z[i] != k;
+        }
+        size_t p = brute_period(a, n);
+        errors += n > 0 && period_smallest(a, n) != p;
+        errors += period_is_repetition(a, n) != (n > 0 && p < n && n % p == 0);
+
+        /* a rotation of a, or a rotation with one byte changed */
+        size_t rot = n ? rand() % n : 0;
+        memcpy(b, a + rot, n - rot);
+        memcpy(b + n - rot, a, rot);
+        if (n > 0 && rand() % 2) {
+            b[rand() % n] = (char)('a' + rand() % alphabet);
+        }
+        errors += period_is_rotation(a, n, b, n) != brute_rotation(a, b, n);
+    }
+    return errors;
+}
+
+int test_period(void)
+{
+    int errors = check_small();
+    if (errors > 0) {
+        printf("period: %d cases differ from brute force\n", errors);
+    }
+
+    /* period close to n, so the divisor scan compares a lot */
+    char *s = (char *)malloc(PD_BENCH_SIZE + 1);
+    char *t = (char *)malloc(PD_BENCH_SIZE + 1);
+    for (int i = 0; i < PD_BENCH_SIZE; i++) {
+        s[i] = 'a';
+    }
+    s[PD_BENCH_SIZE - 1] = 'b';
+    uint64_t t0 = get_time_ns();
+    size_t p1 = brute_period(s, PD_BENCH_SIZE);
+    uint64_t t1 = get_time_ns();
+    size_t p2 = period_smallest(s, PD_BENCH_SIZE);
+    uint64_t t2 = get_time_ns();
+    printf("period of a^%d b: brute %.1f ms, prefix function %.2f ms%s\n",
+           PD_BENCH_SIZE - 1, (t1 - t0) / 1e6, (t2 - t1) / 1e6,
+           p1 == p2 ? "" : " MISMATCH");
+    errors += p1 != p2;
+
+    /* the rotation sits at the far end */
+    memcpy(t, s + 1, PD_BENCH_SIZE - 1);
+    t[PD_BENCH_SIZE - 1] = s[0];
+    t0 = get_time_ns();
+    bool r1 = brute_rotation(s, t, PD_BENCH_SIZE);
+    t1 = get_time_ns();
+    bool r2 = period_is_rotation(s, PD_BENCH_SIZE, t, PD_BENCH_SIZE);
+    t2 = get_time_ns();
+    printf("rotation of %d: brute %.1f ms, KMP %.2f ms%s\n", PD_BENCH_SIZE,
+           (t1 - t0) / 1e6, (t2 - t1) / 1e6, r1 == r2 ? "" : " MISMATCH");
+    errors += r1 != r2;
+    free(s);
+    free(t);
+    return errors > 0 ? -1 : 0;
+}
@@ -0,0 +1,125 @@
+/**
+ * @file test_range_query.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief range query test, every kind against a loop over the range and
+ * query throughput next to the per call summing of numArraySumRange
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "utils.h"
+#include "range_query.h"
+#include "test.h"
+
+#define RQ_TEST_ROUNDS 300
+#define RQ_TEST_OPS 200
+#define RQ_BENCH_SIZE 10000
+#define RQ_BENCH_QUERIES 2000000
+
+static int64_t naive(rq_kind_t kind, const int *a, int l, int r)
+{
+    int64_t acc = kind == RQ_PREFIX_SUM || kind == RQ_FENWICK ? 0 : a[l];
+
+    for (int i = l; i <= r; i++) {
+        if (kind == RQ_SPARSE_MIN) {
+            acc = MIN(acc, (int64_t)a[i]);
+        } else if (kind == RQ_SPARSE_MAX) {
+            acc = MAX(acc, (int64_t)a[i]);
+        } else {
+            acc += a[i];
+        }
+    }
+    return acc;
+}
+
+/* queries mixed with point updates against a loop over the range */
+static int check_ops(void)
+{
+    int a[100];
+    int errors = 0;
+
+    for (int r = 0; r < RQ_TEST_ROUNDS; r++) {
+        int n = 1 + rand() % 100;
+        rq_kind_t kind = (rq_kind_t)(rand() % 4);
+        for (int i = 0; i < n; i++) {
+            a[i] = rand() - RAND_MAX / 2;
+        }
+        range_query_t rq;
+        rq_init(&rq, kind, a, n);
+        for (int op = 0; op < RQ_TEST_OPS; op++) {
+            if (rand() % 4 == 0) {
+                int i = rand() % n;
+                a[i] = rand() - RAND_MAX / 2;
+                rq_update(&rq, i, a[i]);
+                continue;
+            }
+            int l = rand() % n;
+            int h = l + rand() % (n - l);
+            if (rq_query(&rq, l, h) != naive(kind, a, l, h)) {
+                errors++;
+            }
+        }
+        rq_destroy(&rq);
+    }
+    return errors;
+}
+
+int test_range_query(void)
+{
+    static const char *names[] = {"prefix sum", "fenwick", "sparse min",
+                                  "sparse max"};
+
+    int errors = check_ops();
+    if (errors > 0) {
+        printf("range_query: %d queries differ from a loop\n", errors);
+    }
+
+    int *a = (int *)malloc(sizeof(int) * RQ_BENCH_SIZE);
+    int *ql = (int *)malloc(sizeof(int) * RQ_BENCH_QUERIES);
+    int *qr = (int *)malloc(sizeof(int) * RQ_BENCH_QUERIES);
+    for (int i = 0; i < RQ_BENCH_SIZE; i++) {
+        a[i] = rand() % 200001 - 100000;
+    }
+    for (int i = 0; i < RQ_BENCH_QUERIES; i++) {
+        ql[i] = rand() % RQ_BENCH_SIZE;
+        qr[i] = ql[i] + rand() % (RQ_BENCH_SIZE - ql[i]);
+    }
+
+    /* the element loop gets a tenth of the queries */
+    int64_t check = 0;
+    uint64_t t0 = get_time_ns();
+    for (int i = 0; i < RQ_BENCH_QUERIES / 10; i++) {
+        check += naive(RQ_PREFIX_SUM, a, ql[i], qr[i]);
+    }
+    uint64_t cost = (get_time_ns() - t0) * 10;
+    printf("%-10s %7.1f M queries/s\n", "loop",
+           RQ_BENCH_QUERIES * 1e3 / cost);
+
+    int64_t sums[RQ_SPARSE_MAX + 1] = {0};
+    for (int kind = RQ_PREFIX_SUM; kind <= RQ_SPARSE_MAX; kind++) {
+        range_query_t rq;
+        rq_init(&rq, (rq_kind_t)kind, a, RQ_BENCH_SIZE);
+        t0 = get_time_ns();
+        for (int i = 0; i < RQ_BENCH_QUERIES; i++) {
+            sums[kind] += rq_query(&rq, ql[i], qr[i]);
+        }
+        cost = get_time_ns() - t0;
+        check += sums[kind];
+        printf("%-10s %7.1f M queries/s\n", names[kind],
+               RQ_BENCH_QUERIES * 1e3 / cost);
+        rq_destroy(&rq);
+    }
+    printf("checksum %lld\n", (long long)check);
+    /* both sum kinds answered the same queries */
+    errors += sums[RQ_PREFIX_SUM] != sums[RQ_FENWICK];
+
+    free(qr);
+    free(ql);
+    free(a);
+    return errors > 0 ? -1 : 0;
+}
@@ -0,0 +1,135 @@
+/**
+ * @file test_rle.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief run-length test, look-and-say against a naive generator and
+ * codec round trips, then sequence and codec throughput
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "rle.h"
+#include "test.h"
+
+#define RLE_TEST_TERMS 40
+#define RLE_TEST_ROUNDS 2000
+#define RLE_BENCH_TERM 60
+#define RLE_BENCH_SIZE (16 << 20)
+
+/* term by term with a fresh exact buffer each step */
+static char *naive_say(int n)
+{
+    char *s = strdup("1");
+
+    for (int k = 1; k < n; k++) {
+        size_t len = strlen(s);
+        char *t = (char *)malloc(2 * len + 1);
+        size_t o = 0;
+        for (size_t i = 0; i < len;) {
+            size_t j = i;
+            while (j < len && s[j] == s[i]) {
+                j++;
+            }
+            o += sprintf(t + o, "%zu%c", j - i, s[i]);
+            i = j;
+        }
+        free(s);
+        s = t;
+    }
+    return s;
+}
+
+/* count and say against the naive terms, then codec round trips */
+static int check_round_trip(void)
+{
+    int errors = 0;
+
+    for (int n = 1; n <= RLE_TEST_TERMS; n++) {
+        size_t len;
+        char *want = naive_say(n);
+        char *got = rle_count_and_say(n, &len);
+        errors += len != strlen(want) || strcmp(want, got) != 0;
+        free(want);
+        free(got);
+    }
+
+    /* runs of ten and more need several count digits */
+    char out[64];
+    size_t o = rle_say("aaaaaaaaaaaab", 13, out);
+    errors += o != 5 || memcmp(out, "12a1b", 5) != 0;
+
+    uint8_t src[1024], enc[1100], dec[1024];
+    for (int r = 0; r < RLE_TEST_ROUNDS; r++) {
+        size_t n = rand() % sizeof(src);
+        int alphabet = 1 + rand() % 4;
+        for (size_t i = 0; i < n;) {
+            size_t run = rand() % 3 ? 1 + rand() % 3 : rand() % 300;
+            uint8_t c = (uint8_t)(rand() % alphabet);
+            for (; run > 0 && i < n; run--) {
+                src[i++] = c;
+            }
+        }
+        size_t e = rle_encode(src, n, enc);
+        errors += e > rle_encode_bound(n);
+        errors += rle_decoded_size(enc, e) != n;
+        errors += rle_decode(enc, e, dec, n) != n;
+        errors += memcmp(src, dec, n) != 0;
+        if (n > 0) {
+            errors += rle_decode(enc, e, dec, n - 1) != RLE_ERROR;
+            errors += rle_decoded_size(enc, e - 1) != RLE_ERROR;
+        }
+    }
+    return errors;
+}
+
+int test_rle(void)
+{
+    int errors = check_round_trip();
+    if (errors > 0) {
+        printf("rle: %d cases differ from the input or the naive terms\n",
+               errors);
+    }
+
+    size_t len;
+    uint64_t t0 = get_time_ns();
+    char *s = rle_count_and_say(RLE_BENCH_TERM, &len);
+    uint64_t t1 = get_time_ns();
+    printf("count and say %d: %zu bytes in %.1f ms\n", RLE_BENCH_TERM, len,
+           (t1 - t0) / 1e6);
+    free(s);
+
+    /* text like data, long runs mixed with literals */
+    uint8_t *src = (uint8_t *)malloc(RLE_BENCH_SIZE);
+    uint8_t *enc = (uint8_t *)malloc(rle_encode_bound(RLE_BENCH_SIZE));
+    for (size_t i = 0; i < RLE_BENCH_SIZE;) {
+        size_t run = rand() % 4 ? 1 : rand() % 64;
+        uint8_t c = (uint8_t)(rand() % 8 ? 'a' + rand() % 26 : ' ');
+        for (; run > 0 && i < RLE_BENCH_SIZE; run--) {
+            src[i++] = c;
+        }
+    }
+    t0 = get_time_ns();
+    size_t e = rle_encode(src, RLE_BENCH_SIZE, enc);
+    t1 = get_time_ns();
+    size_t n = rle_decoded_size(enc, e);
+    uint8_t *dec = (uint8_t *)malloc(n);
+    rle_decode(enc, e, dec, n);
+    uint64_t t2 = get_time_ns();
+    int diff = n != RLE_BENCH_SIZE || memcmp(src, dec, n) != 0;
+    printf("codec %d MB -> %.1f MB: encode %.0f MB/s, decode %.0f MB/s%s\n",
+           RLE_BENCH_SIZE >> 20, e / 1048576.0,
+           RLE_BENCH_SIZE / 1048576.0 / ((t1 - t0) / 1e9),
+           RLE_BENCH_SIZE / 1048576.0 / ((t2 - t1) / 1e9),
+           diff ? " MISMATCH" : "");
+    errors += diff;
+    free(src);
+    free(enc);
+    free(dec);
+    return errors > 0 ? -1 : 0;
+}
@@ -0,0 +1,217 @@
+/**
+ * @file test_scan.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief scan test, every scan against a plain loop on random arrays of
+ * odd sizes, threads forced on a large one, then 16M element benchmarks
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+
+#include "utils.h"
+#include "scan.h"
+#include "test.h"
+
+#define SC_TEST_ROUNDS 2000
+#define SC_TEST_SIZE 300
+#define SC_BENCH_SIZE (16 << 20)
+
+static int64_t brute_max_subarray(const int *a, size_t n)
+{
+    int64_t best = a[0];
+
+    for (size_t i = 0; i < n; i++) {
+        int64_t s = 0;
+        for (size_t j = i; j < n; j++) {
+            s += a[j];
+            best = MAX(best, s);
+        }
+    }
+    return best;
+}
+
+static int64_t brute_max_product(const int *a, size_t n)
+{
+    int64_t best = a[0];
+
+    for (size_t i = 0; i < n; i++) {
+        int64_t p = 1;
+        for (size_t j = i; j < n; j++) {
+            p *= a[j];
+            best = MAX(best, p);
+        }
+    }
+    return best;
+}
+
+static int64_t brute_max_gain(const int *a, size_t n)
+{
+    int64_t best = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = i; j < n; j++) {
+            best = MAX(best, (int64_t)a[j] - a[i]);
+        }
+    }
+    return best;
+}
+
+static void fill(int *a, size_t n, int kind)
+{
+    for (size_t i = 0; i < n; i++) {
+        switch (kind) {
+        case 0: /* extremes, sums need 64 bits */
+            a[i] = rand() % 2 ? INT_MAX - rand() % 3 : INT_MIN + rand() % 3;
+            break;
+        case 1:
+            a[i] = rand() % 2;
+            break;
+        case 2: /* mostly ones, long runs */
+            a[i] = rand() % 50 != 0;
+            break;
+        default:
+            a[i] = rand() % 21 - 10;
+            break;
+        }
+    }
+}
+
+static int check_one(const int *a, size_t n, int threads, int *out)
+{
+    int errors = 0;
+
+    scan_prefix_sum(a, out, n, threads);
+    unsigned run = 0;
+    for (size_t i = 0; i < n; i++) {
+        run += (unsigned)a[i];
+        errors += out[i] != (int)run;
+    }
+    int64_t sum = 0;
+    for (size_t i = 0; i < n; i++) {
+        sum += a[i];
+    }
+    errors += scan_sum(a, n, threads) != sum;
+    return errors;
+}
+
+/* every scan against its brute force, then chunked against one thread */
+static int check_scans(void)
+{
+    int a[SC_TEST_SIZE], out[SC_TEST_SIZE];
+    int errors = 0;
+
+    for (int r = 0; r < SC_TEST_ROUNDS; r++) {
+        size_t n = 1 + rand() % SC_TEST_SIZE;
+        int kind = r % 4;
+        fill(a, n, kind);
+        errors += check_one(a, n, 1, out);
+        errors += scan_max_subarray(a, n, 1) != brute_max_subarray(a, n);
+        errors += scan_max_gain(a, n, 1) != brute_max_gain(a, n);
+
+        size_t run = 0, cur = 0;
+        for (size_t i = 0; i < n; i++) {
+            cur = a[i] == 1 ? cur + 1 : 0;
+            run = MAX(run, cur);
+        }
+        errors += scan_longest_run(a, n, 1) != run;
+
+        ptrdiff_t pivot = -1;
+        for (size_t i = 0; i < n && pivot < 0; i++) {
+            int64_t left = 0, right = 0;
+            for (size_t j = 0; j < n; j++) {
+                *(j < i ? &left : &right) += j == i ? 0 : a[j];
+            }
+            pivot = left == right ? (ptrdiff_t)i : -1;
+        }
+        errors += scan_balance_index(a, n) != pivot;
+
+        /* small factors keep every product inside 64 bits */
+        size_t m = MIN(n, (size_t)40);
+        for (size_t i = 0; i < m; i++) {
+            a[i] = rand() % 7 - 3;
+        }
+        errors += scan_max_product(a, m) != brute_max_product(a, m);
+    }
+
+    /* large enough for four chunks, each with its own AVX2 segments */
+    size_t n = 4 * SCAN_PARALLEL_MIN + 37;
+    int *b = (int *)malloc(sizeof(int) * n);
+    int *o = (int *)malloc(sizeof(int) * n);
+    for (int kind = 0; kind < 4; kind++) {
+        fill(b, n, kind);
+        errors += check_one(b, n, 4, o);
+        errors += scan_max_subarray(b, n, 4) != scan_max_subarray(b, n, 1);
+        errors += scan_max_gain(b, n, 4) != scan_max_gain(b, n, 1);
+    }
+    free(b);
+    free(o);
+    return errors;
+}
+
+int test_scan(void)
+{
+    int errors = check_scans();
+    if (errors > 0) {
+        printf("scan: %d results differ from brute force\n", errors);
+    }
+
+    int *a = (int *)malloc(sizeof(int) * SC_BENCH_SIZE);
+    int *out = (int *)malloc(sizeof(int) * SC_BENCH_SIZE);
+    fill(a, SC_BENCH_SIZE, 3);
+
+    /* the loops the demos had, Kadane and a running sum */
+    uint64_t t0 = get_time_ns();
+    int64_t cur = a[0], best = a[0];
+    for (size_t i = 1; i < SC_BENCH_SIZE; i++) {
+        cur = cur > 0 ? cur + a[i] : a[i];
+        best = MAX(best, cur);
+    }
+    uint64_t t1 = get_time_ns();
+    int64_t got = scan_max_subarray(a, SC_BENCH_SIZE, 1);
+    uint64_t t2 = get_time_ns();
+    int64_t par = scan_max_subarray(a, SC_BENCH_SIZE, 0);
+    uint64_t t3 = get_time_ns();
+    printf("max subarray of %d: loop %.2f ms, scan %.2f ms, all CPUs %.2f "
+           "ms%s\n",
+           SC_BENCH_SIZE, (t1 - t0) / 1e6, (t2 - t1) / 1e6, (t3 - t2) / 1e6,
+           best == got && got == par ? "" : " MISMATCH");
+    errors += best != got || got != par;
+
+    t0 = get_time_ns();
+    int run = 0;
+    for (size_t i = 0; i < SC_BENCH_SIZE; i++) {
+        run += a[i];
+        out[i] = run;
+    }
+    int last = out[SC_BENCH_SIZE - 1];
+    t1 = get_time_ns();
+    scan_prefix_sum(a, out, SC_BENCH_SIZE, 1);
+    t2 = get_time_ns();
+    printf("prefix sum of %d: loop %.2f ms, scan %.2f ms%s\n", SC_BENCH_SIZE,
+           (t1 - t0) / 1e6, (t2 - t1) / 1e6,
+           last == out[SC_BENCH_SIZE - 1] ? "" : " MISMATCH");
+    errors += last != out[SC_BENCH_SIZE - 1];
+
+    fill(a, SC_BENCH_SIZE, 2);
+    t0 = get_time_ns();
+    size_t longest = 0, len = 0;
+    for (size_t i = 0; i < SC_BENCH_SIZE; i++) {
+        len = a[i] == 1 ? len + 1 : 0;
+        longest = MAX(longest, len);
+    }
+    t1 = get_time_ns();
+    size_t fast = scan_longest_run(a, SC_BENCH_SIZE, 1);
+    t2 = get_time_ns();
+    printf("longest run of ones in %d: loop %.2f ms, scan %.2f ms%s\n",
+           SC_BENCH_SIZE, (t1 - t0) / 1e6, (t2 - t1) / 1e6,
+           longest == fast ? "" : " MISMATCH");
+    errors += longest != fast;
+    free(a);
+    free(out);
+    return errors > 0 ? -1 : 0;
+}
@@ -0,0 +1,174 @@
+/**
+ * @file test_skiplist.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief skip list ordered set test, rank/range queries and readers
+ * running next to one writer
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "utils.h"
+#include "skiplist.h"
+#include "test.h"
+
+#define SKIPLIST_READERS 3
+#define SKIPLIST_OPS 20000
+/* the writer keeps going until every reader has walked this many times */
+#define SKIPLIST_PASSES 2000
+
+typedef struct {
+    unsigned int seed;
+    long passes;
+    long walked;
+    long errors;
+} reader_t;
+
+static skiplist_t *g_sl;
+static volatile int g_stop;
+static volatile int g_go;
+
+/* readers check the set stays sorted and that even keys, which are never
+   erased by the writer, are always found */
+static void *skiplist_reader(void *arg)
+{
+    reader_t *r = (reader_t *)arg;
+    long lookups = 0;
+    long errors = 0;
+    unsigned int seed = r->seed;
+
+    while (!__atomic_load_n(&g_go, __ATOMIC_ACQUIRE)) {
+        sched_yield();
+    }
+    while (!__atomic_load_n(&g_stop, __ATOMIC_ACQUIRE)) {
+        unsigned int token = skiplist_reader_enter(g_sl);
+        int key = (rand_r(&seed) % 1000) * 2;
+        if (skiplist_find_int(g_sl, key) == NULL) {
+            errors++;
+        }
+        skiplist_node_t *node;
+        int last = key - 1;
+        int cnt = 0;
+        SKIPLIST_FOREACH_RANGE_INT(g_sl, node, key, key + 100)
+        {
+            if (node->key.i <= last) {
+                errors++;
+            }
+            last = node->key.i;
+            cnt++;
+        }
+        skiplist_reader_exit(g_sl, token);
+        lookups += cnt;
+        __atomic_add_fetch(&r->passes, 1, __ATOMIC_RELEASE);
+    }
+    r->walked = lookups;
+    r->errors = errors;
+    return NULL;
+}
+
+static bool readers_done(reader_t *r)
+{
+    for (int i = 0; i < SKIPLIST_READERS; i++) {
+        if (__atomic_load_n(&r[i].passes, __ATOMIC_ACQUIRE) <
+            SKIPLIST_PASSES) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int test_skiplist(void)
+{
+    skiplist_t *sl = skiplist_create(SKIPLIST_KEY_INT);
+    int nums[] = {5, 1, 9, 3, 7, 3, 11, -4};
+    skiplist_node_t *node;
+
+    for (size_t i = 0; i < ARRAY_SIZE(nums); i++) {
+        skiplist_insert_int(sl, nums[i], NULL);
+    }
+    printf("size=%zu rank(7)=%zu rank(8)=%zu select(2)=%d\n",
+           skiplist_size(sl), skiplist_rank_int(sl, 7),
+           skiplist_rank_int(sl, 8), skiplist_select(sl, 2)->key.i);
+    printf("range [2, 9]: ");
+    SKIPLIST_FOREACH_RANGE_INT(sl, node, 2, 9)
+    {
+        printf("%d ", node->key.i);
+    }
+    printf("\n");
+    skiplist_erase_int(sl, 5);
+    printf("erase 5, rank(7)=%zu\n", skiplist_rank_int(sl, 7));
+    skiplist_destroy(sl);
+
+    /* leaderboard keyed by player name */
+    const char *names[] = {"carol", "alice", "dave", "bob"};
+    sl = skiplist_create(SKIPLIST_KEY_STR);
+    for (size_t i = 0; i < ARRAY_SIZE(names); i++) {
+        skiplist_insert_str(sl, names[i], (void *)names[i]);
+    }
+    for (node = skiplist_first(sl); node != NULL; node = skiplist_next(node)) {
+        printf("%zu:%s ", skiplist_rank_str(sl, node->key.s), node->key.s);
+    }
+    printf("\n");
+    skiplist_destroy(sl);
+
+    /* one writer churns odd keys while readers walk the list, all start
+       together and the writer only stops once every reader has walked */
+    pthread_t readers[SKIPLIST_READERS];
+    reader_t state[SKIPLIST_READERS];
+    int started = 0;
+    g_sl = skiplist_create(SKIPLIST_KEY_INT);
+    g_stop = 0;
+    g_go = 0;
+    for (int i = 0; i < 2000; i += 2) {
+        skiplist_insert_int(g_sl, i, NULL);
+    }
+    for (int i = 0; i < SKIPLIST_READERS; i++) {
+        state[i] = (reader_t){(unsigned int)i + 1, 0, 0, 0};
+        if (pthread_create(&readers[i], NULL, skiplist_reader, &state[i]) !=
+            0) {
+            break;
+        }
+        started++;
+    }
+    if (started < SKIPLIST_READERS) {
+        printf("reader threads failed to start\n");
+        __atomic_store_n(&g_stop, 1, __ATOMIC_RELEASE);
+        __atomic_store_n(&g_go, 1, __ATOMIC_RELEASE);
+        for (int i = 0; i < started; i++) {
+            pthread_join(readers[i], NULL);
+        }
+        skiplist_destroy(g_sl);
+        return -1;
+    }
+    __atomic_store_n(&g_go, 1, __ATOMIC_RELEASE);
+    uint64_t start = get_time_ns();
+    unsigned int seed = 1;
+    int ops = 0;
+    for (; ops < SKIPLIST_OPS || !readers_done(state); ops++) {
+        int key = (rand_r(&seed) % 1000) * 2 + 1;
+        if (ops & 1) {
+            skiplist_erase_int(g_sl, key);
+        } else {
+            skiplist_insert_int(g_sl, key, NULL);
+        }
+    }
+    uint64_t cost = get_time_ns() - start;
+    __atomic_store_n(&g_stop, 1, __ATOMIC_RELEASE);
+    int failed = 0;
+    for (int i = 0; i < SKIPLIST_READERS; i++) {
+        pthread_join(readers[i], NULL);
+        printf("reader: %ld passes, %ld nodes walked, %ld errors\n",
+               state[i].passes, state[i].walked, state[i].errors);
+        failed += state[i].walked == 0 || state[i].errors != 0;
+    }
+    printf("writer: %d updates, %.1f ns/op, size=%zu\n", ops,
+           (double)cost / ops, skiplist_size(g_sl));
+    skiplist_destroy(g_sl);
+    return failed ? -1 : 0;
+}
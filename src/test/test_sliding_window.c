@@ -0,0 +1,154 @@
+/**
+ * @file test_sliding_window.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief sliding window test, checks against brute force and times the
+ * window rescan against the last-seen table
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "sliding_window.h"
+#include "test.h"
+
+#define SW_TEST_ROUNDS 5000
+#define SW_LC_SIZE 50000
+#define SW_STREAM_SIZE (64 << 20)
+#define SW_CHUNK 4096
+
+/* every start, extend while the window stays valid */
+static uint64_t brute_force(const uint8_t *s, int n, int k, uint64_t *start)
+{
+    uint64_t best = 0;
+
+    for (int i = 0; i < n; i++) {
+        int cnt[256] = {0};
+        int distinct = 0;
+        for (int j = i; j < n; j++) {
+            if (cnt[s[j]]++ == 0) {
+                distinct++;
+            }
+            if (k == SW_NO_REPEAT ? cnt[s[j]] > 1 : distinct > k) {
+                break;
+            }
+            if ((uint64_t)(j - i + 1) > best) {
+                best = j - i + 1;
+                *start = i;
+            }
+        }
+    }
+    return best;
+}
+
+/* the rescanning loop lengthOfLongestSubstring used */
+static int rescan(const char *s)
+{
+    if (!s[0]) {
+        return 0;
+    }
+    int max = 1, n = 0;
+
+    for (int i = 1; s[i] != 0; i++) {
+        int tmp = 1;
+        for (int j = n; j < i; j++) {
+            if (s[j] == s[i]) {
+                n = j + 1;
+                break;
+            } else {
+                tmp++;
+            }
+        }
+        max = tmp > max ? tmp : max;
+    }
+    return max;
+}
+
+/* random chunked feeds against the brute force window */
+static int check_chunked(void)
+{
+    uint8_t s[120];
+    int errors = 0;
+
+    for (int r = 0; r < SW_TEST_ROUNDS; r++) {
+        int n = rand() % sizeof(s);
+        int alphabet = 1 + rand() % 8;
+        int k = rand() % 5;
+        for (int i = 0; i < n; i++) {
+            s[i] = rand() % alphabet;
+        }
+        sw_window_t w;
+        sw_init(&w, k);
+        /* uneven chunks, the state carries across */
+        for (int i = 0; i < n;) {
+            int len = MIN(n - i, 1 + rand() % 7);
+            sw_feed(&w, s + i, len);
+            i += len;
+        }
+        uint64_t want_start = 0, got_start = 0;
+        uint64_t want = brute_force(s, n, k, &want_start);
+        uint64_t got = sw_best(&w, &got_start);
+        if (want != got || want_start != got_start) {
+            errors++;
+        }
+    }
+    return errors;
+}
+
+int test_sliding_window(void)
+{
+    int errors = check_chunked();
+    if (errors > 0) {
+        printf("sliding_window: %d cases differ from brute force\n", errors);
+    }
+
+    /* LeetCode limits, the printable bytes up and then down again, each
+       turn repeats the last byte so the rescan regrows the whole window */
+    char *s = (char *)malloc(SW_LC_SIZE + 1);
+    for (int i = 0; i < SW_LC_SIZE; i++) {
+        int j = i % 190;
+        s[i] = ' ' + (j < 95 ? j : 189 - j);
+    }
+    s[SW_LC_SIZE] = '\0';
+    uint64_t t0 = get_time_ns();
+    int a = rescan(s);
+    uint64_t t1 = get_time_ns();
+    sw_window_t w;
+    sw_init(&w, SW_NO_REPEAT);
+    sw_feed(&w, s, SW_LC_SIZE);
+    uint64_t t2 = get_time_ns();
+    printf("5e4 chars: rescan %d in %.3f ms, table %d in %.3f ms\n", a,
+           (t1 - t0) / 1e6, (int)sw_best(&w, NULL), (t2 - t1) / 1e6);
+    errors += (uint64_t)a != sw_best(&w, NULL);
+    free(s);
+
+    /* stream in chunks, only the window state is kept */
+    uint8_t *chunk = (uint8_t *)malloc(SW_CHUNK);
+    sw_window_t u, k3;
+    sw_init(&u, SW_NO_REPEAT);
+    sw_init(&k3, 3);
+    uint64_t cost_u = 0, cost_k = 0;
+    for (int i = 0; i < SW_STREAM_SIZE / SW_CHUNK; i++) {
+        for (int j = 0; j < SW_CHUNK; j++) {
+            chunk[j] = rand() % 4 ? rand() % 200 : 'a' + rand() % 4;
+        }
+        t0 = get_time_ns();
+        sw_feed(&u, chunk, SW_CHUNK);
+        t1 = get_time_ns();
+        sw_feed(&k3, chunk, SW_CHUNK);
+        t2 = get_time_ns();
+        cost_u += t1 - t0;
+        cost_k += t2 - t1;
+    }
+    printf("%d MB stream: no repeat %llu in %.1f ms, k=3 %llu in %.1f ms\n",
+           SW_STREAM_SIZE >> 20, (unsigned long long)sw_best(&u, NULL),
+           cost_u / 1e6, (unsigned long long)sw_best(&k3, NULL),
+           cost_k / 1e6);
+    free(chunk);
+    return errors > 0 ? -1 : 0;
+}
@@ -0,0 +1,177 @@
+/**
+ * @file test_str_search.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief substring search test, checks against a naive matcher and compares
+ * speed on log-like text and on adversarial input
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "str_search.h"
+#include "test.h"
+
+#define SS_TEST_ROUNDS 200000
+#define SS_BENCH_SIZE (64 << 20)
+#define SS_BAD_SIZE (1 << 20)
+
+/* the old strStr loop */
+static const char *naive_search(const char *h, size_t hn, const char *n,
+                                size_t nn)
+{
+    size_t i = 0, j = 0;
+
+    if (nn == 0) {
+        return h;
+    }
+    while (i < hn && j < nn) {
+        if (h[i] == n[j]) {
+            i++;
+            j++;
+        } else {
+            i = i - j + 1;
+            j = 0;
+        }
+        if (j == nn) {
+            return h + i - j;
+        }
+    }
+    return NULL;
+}
+
+static void random_text(char *s, size_t len, int alphabet)
+{
+    for (size_t i = 0; i < len; i++) {
+        s[i] = 'a' + rand() % alphabet;
+    }
+}
+
+/* both single needle searches and the multi search against naive_search */
+static int check_naive(void)
+{
+    char h[300], n[40];
+    const char *needles[4];
+    size_t lens[4];
+    str_multi_t *sm = (str_multi_t *)malloc(sizeof(str_multi_t));
+    int errors = 0;
+
+    for (int r = 0; r < SS_TEST_ROUNDS; r++) {
+        int alphabet = 1 + rand() % 4;
+        size_t hn = rand() % sizeof(h);
+        size_t nn = rand() % sizeof(n);
+        random_text(h, hn, alphabet);
+        random_text(n, nn, alphabet);
+        /* plant the needle sometimes */
+        if (nn <= hn && rand() % 2) {
+            memcpy(h + rand() % (hn - nn + 1), n, nn);
+        }
+        const char *want = naive_search(h, hn, n, nn);
+        if (str_search(h, hn, n, nn) != want ||
+            str_search_two_way(h, hn, n, nn) != want) {
+            errors++;
+        }
+
+        /* multi needle, the leftmost start of any of the needles */
+        int k = 1 + rand() % 4;
+        const char *best = NULL;
+        for (int i = 0; i < k; i++) {
+            needles[i] = n + rand() % 8;
+            lens[i] = 1 + rand() % 8;
+            const char *p = naive_search(h, hn, needles[i], lens[i]);
+            if (p != NULL && (best == NULL || p < best)) {
+                best = p;
+            }
+        }
+        str_multi_init(sm, needles, lens, k);
+        if (str_multi_search(sm, h, hn, NULL) != best) {
+            errors++;
+        }
+    }
+    free(sm);
+    return errors;
+}
+
+static int bench(const char *name, const char *h, size_t hn, const char *n)
+{
+    size_t nn = strlen(n);
+    uint64_t t0 = get_time_ns();
+    const char *a = naive_search(h, hn, n, nn);
+    uint64_t t1 = get_time_ns();
+    const char *b = strstr(h, n);
+    uint64_t t2 = get_time_ns();
+    const char *c = str_search(h, hn, n, nn);
+    uint64_t t3 = get_time_ns();
+    const char *d = str_search_two_way(h, hn, n, nn);
+    uint64_t t4 = get_time_ns();
+
+    printf("%-10s naive %7.1f ms, strstr %6.1f ms, str_search %6.1f ms, "
+           "two_way %6.1f ms%s\n",
+           name, (t1 - t0) / 1e6, (t2 - t1) / 1e6, (t3 - t2) / 1e6,
+           (t4 - t3) / 1e6, a == b && b == c && c == d ? "" : " MISMATCH");
+    return a != b || b != c || c != d;
+}
+
+int test_str_search(void)
+{
+    int errors = check_naive();
+    if (errors > 0) {
+        printf("str_search: %d cases differ from the naive loop\n", errors);
+    }
+
+    /* log-like text, the needle is near the end */
+    static const char *words[] = {"INFO ", "WARN ", "conn ", "closed ",
+                                  "request ", "id=", "200 ", "\n"};
+    char *log = (char *)malloc(SS_BENCH_SIZE + 1);
+    size_t len = 0;
+    while (len + 16 < SS_BENCH_SIZE) {
+        const char *w = words[rand() % 8];
+        memcpy(log + len, w, strlen(w));
+        len += strlen(w);
+    }
+    strcpy(log + len - 16, "ERROR timeout");
+    log[len] = '\0';
+    errors += bench("log", log, len, "ERROR timeout");
+
+    /* haystack of 'a', needle a..ab, quadratic for the naive loop */
+    char *bad = (char *)malloc(SS_BAD_SIZE + 1);
+    char needle[1025];
+    memset(bad, 'a', SS_BAD_SIZE);
+    bad[SS_BAD_SIZE] = '\0';
+    memset(needle, 'a', 1023);
+    needle[1023] = 'b';
+    needle[1024] = '\0';
+    errors += bench("aaa..ab", bad, SS_BAD_SIZE, needle);
+
+    /* multi needle vs one pass per needle */
+    const char *needles[] = {"ERROR", "FATAL", "panic", "timeout"};
+    size_t lens[] = {5, 5, 5, 7};
+    str_multi_t *sm = (str_multi_t *)malloc(sizeof(str_multi_t));
+    str_multi_init(sm, needles, lens, 4);
+    uint64_t t0 = get_time_ns();
+    int which = -1;
+    const char *p = str_multi_search(sm, log, len, &which);
+    uint64_t t1 = get_time_ns();
+    const char *q = NULL;
+    for (int i = 0; i < 4; i++) {
+        const char *r = str_search(log, len, needles[i], lens[i]);
+        if (r != NULL && (q == NULL || r < q)) {
+            q = r;
+        }
+    }
+    uint64_t t2 = get_time_ns();
+    printf("multi: found %s, one pass %.1f ms, per needle %.1f ms%s\n",
+           which >= 0 ? needles[which] : "-", (t1 - t0) / 1e6,
+           (t2 - t1) / 1e6, p == q ? "" : " MISMATCH");
+    errors += p != q;
+
+    free(sm);
+    free(bad);
+    free(log);
+    return errors > 0 ? -1 : 0;
+}
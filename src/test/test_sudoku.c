@@ -0,0 +1,210 @@
+/**
+ * @file test_sudoku.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief sudoku test, validation against the three pass counter check and
+ * solutions checked against their clues, then puzzles per second of plain
+ * backtracking and of the propagating solver
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "sudoku.h"
+#include "test.h"
+
+#define SD_TEST_ROUNDS 2000
+#define SD_BENCH_PUZZLES 5000
+#define SD_BENCH_BACKTRACK 50 /* the first ones, it is that slow */
+#define SD_BENCH_CLUES 26
+#define SD_NUM_HARD ((int)(sizeof(hard) / sizeof(hard[0])))
+
+static const char *hard[] = {
+    "4.....8.5.3..........7......2.....6.....8.4......1.......6.3.7.5..2....."
+    "1.4......",
+    "8..........36......7..9.2...5...7.......457.....1...3...1....68..85...1."
+    ".9....4..",
+    "..53.....8......2..7..1.5..4....53...1..7...6..32...8..6.5....9..4....3."
+    ".....97..",
+};
+
+/* the counter passes isValidSudoku used, rows, columns and boxes */
+static bool three_pass(const sudoku_grid_t g)
+{
+    for (int u = 0; u < 27; u++) {
+        int cnt[10] = {0};
+        for (int j = 0; j < 9; j++) {
+            int c = u < 9    ? u * 9 + j :
+                    u < 18   ? j * 9 + (u - 9) :
+                               ((u - 18) / 3 * 3 + j / 3) * 9 +
+                                 (u - 18) % 3 * 3 + j % 3;
+            if (g[c] != 0 && cnt[g[c]]++ > 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/* a solved grid from the shifted row pattern, shuffled by digit, rows in
+   a band, columns in a stack, bands and stacks */
+static void random_solution(sudoku_grid_t g)
+{
+    int digit[9], row[9], col[9];
+
+    for (int i = 0; i < 9; i++) {
+        digit[i] = i + 1;
+    }
+    for (int i = 8; i > 0; i--) {
+        int j = rand() % (i + 1), t = digit[i];
+        digit[i] = digit[j];
+        digit[j] = t;
+    }
+    int *perm[2] = {row, col};
+    for (int p = 0; p < 2; p++) {
+        int band[3] = {0, 1, 2};
+        for (int i = 2; i > 0; i--) {
+            int j = rand() % (i + 1), t = band[i];
+            band[i] = band[j];
+            band[j] = t;
+        }
+        for (int b = 0; b < 3; b++) {
+            int in[3] = {0, 1, 2};
+            for (int i = 2; i > 0; i--) {
+                int j = rand() % (i + 1), t = in[i];
+                in[i] = in[j];
+                in[j] = t;
+            }
+            for (int i = 0; i < 3; i++) {
+                perm[p][b * 3 + i] = band[b] * 3 + in[i];
+            }
+        }
+    }
+    for (int r = 0; r < 9; r++) {
+        for (int c = 0; c < 9; c++) {
+            int pr = row[r], pc = col[c];
+            g[r * 9 + c] = (uint8_t)digit[(pr * 3 + pr / 3 + pc) % 9];
+        }
+    }
+}
+
+static void random_puzzle(sudoku_grid_t g, int clues)
+{
+    random_solution(g);
+    for (int open = SUDOKU_CELLS - clues; open > 0;) {
+        int c = rand() % SUDOKU_CELLS;
+        if (g[c] != 0) {
+            g[c] = 0;
+            open--;
+        }
+    }
+}
+
+static bool solves(const sudoku_grid_t puzzle, const sudoku_grid_t g)
+{
+    for (int c = 0; c < SUDOKU_CELLS; c++) {
+        if (g[c] == 0 || (puzzle[c] != 0 && puzzle[c] != g[c])) {
+            return false;
+        }
+    }
+    return sudoku_valid(g);
+}
+
+/* random and broken grids against the three pass check, then the hard set */
+static int check_puzzles(void)
+{
+    sudoku_grid_t g, p;
+    int errors = 0;
+
+    for (int r = 0; r < SD_TEST_ROUNDS; r++) {
+        random_puzzle(g, 17 + rand() % 50);
+        /* break it half of the time */
+        if (r % 2) {
+            g[rand() % SUDOKU_CELLS] = (uint8_t)(1 + rand() % 9);
+        }
+        errors += sudoku_valid(g) != three_pass(g);
+        memcpy(p, g, sizeof(p));
+        /* a broken grid may still be valid yet have no solution */
+        int n = sudoku_solve(g, 1);
+        errors += n > 0 ? !solves(p, g) : r % 2 == 0;
+    }
+    for (int i = 0; i < SD_NUM_HARD; i++) {
+        sudoku_parse(hard[i], g);
+        memcpy(p, g, sizeof(p));
+        errors += sudoku_solve(g, 2) != 1 || !solves(p, g);
+    }
+    /* an empty grid has many solutions */
+    memset(g, 0, sizeof(g));
+    errors += sudoku_solve(g, 2) != 2;
+    return errors;
+}
+
+/* first empty cell, every digit that fits, no propagation */
+static bool backtrack(sudoku_grid_t g)
+{
+    int c = 0;
+
+    while (c < SUDOKU_CELLS && g[c] != 0) {
+        c++;
+    }
+    if (c == SUDOKU_CELLS) {
+        return true;
+    }
+    for (int d = 1; d <= 9; d++) {
+        g[c] = (uint8_t)d;
+        if (sudoku_valid(g) && backtrack(g)) {
+            return true;
+        }
+    }
+    g[c] = 0;
+    return false;
+}
+
+int test_sudoku(void)
+{
+    int errors = check_puzzles();
+    if (errors > 0) {
+        printf("sudoku: %d grids checked or solved wrongly\n", errors);
+    }
+
+    sudoku_grid_t *puzzles =
+        (sudoku_grid_t *)malloc(sizeof(sudoku_grid_t) * SD_BENCH_PUZZLES);
+    sudoku_grid_t g;
+    for (int i = 0; i < SD_BENCH_PUZZLES; i++) {
+        random_puzzle(puzzles[i], SD_BENCH_CLUES);
+    }
+
+    int solved_a = 0, solved_b = 0;
+    uint64_t t0 = get_time_ns();
+    for (int i = 0; i < SD_BENCH_BACKTRACK; i++) {
+        memcpy(g, puzzles[i], sizeof(g));
+        solved_a += backtrack(g);
+    }
+    uint64_t t1 = get_time_ns();
+    for (int i = 0; i < SD_BENCH_PUZZLES; i++) {
+        memcpy(g, puzzles[i], sizeof(g));
+        solved_b += sudoku_solve(g, 1);
+    }
+    uint64_t t2 = get_time_ns();
+    int diff = solved_a != SD_BENCH_BACKTRACK || solved_b != SD_BENCH_PUZZLES;
+    printf("%d clues: backtracking %.0f puzzles/s, solver %.0f puzzles/s%s\n",
+           SD_BENCH_CLUES, SD_BENCH_BACKTRACK / ((t1 - t0) / 1e9),
+           SD_BENCH_PUZZLES / ((t2 - t1) / 1e9), diff ? " MISMATCH" : "");
+    errors += diff;
+
+    t0 = get_time_ns();
+    for (int i = 0; i < SD_NUM_HARD; i++) {
+        sudoku_parse(hard[i], g);
+        sudoku_solve(g, 2);
+    }
+    t1 = get_time_ns();
+    printf("%d hard puzzles, uniqueness proved: %.1f us each\n",
+           SD_NUM_HARD, (t1 - t0) / 1e3 / SD_NUM_HARD);
+    free(puzzles);
+    return errors > 0 ? -1 : 0;
+}
@@ -0,0 +1,150 @@
+/**
+ * @file test_timer_wheel.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief timer wheel test, expiry accuracy in simulated ticks and cpu use
+ * while waiting on many real timeouts
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/timerfd.h>
+
+#include "utils.h"
+#include "timer_wheel.h"
+#include "test.h"
+
+#define TW_TEST_TIMERS 200000
+#define TW_TEST_SPAN 5000000 /* ticks */
+#define TW_IDLE_TIMERS 100000
+#define TW_IDLE_SPAN_MS 1500
+
+typedef struct {
+    tw_timer_t timer;
+    timer_wheel_t *tw;
+    uint64_t due;
+    int fired;
+    int late;
+} tw_test_t;
+
+static void tw_test_cb(tw_timer_t *timer, void *arg)
+{
+    tw_test_t *t = (tw_test_t *)arg;
+    /* jiffies already moved past the tick being run */
+    if (t->tw->jiffies - 1 != t->due) {
+        t->late++;
+    }
+    t->fired++;
+}
+
+static int tw_idle_fired;
+
+static void tw_idle_cb(tw_timer_t *timer, void *arg)
+{
+    tw_idle_fired++;
+}
+
+int test_timer_wheel(void)
+{
+    timer_wheel_t *tw = (timer_wheel_t *)malloc(sizeof(timer_wheel_t));
+    tw_test_t *ts = (tw_test_t *)malloc(sizeof(tw_test_t) * TW_TEST_TIMERS);
+    int fired = 0, late = 0, twice = 0, cancelled = 0, errors = 0;
+
+    /* simulated ticks, every timer must fire exactly on its tick */
+    timer_wheel_init(tw, 1000);
+    for (int i = 0; i < TW_TEST_TIMERS; i++) {
+        tw_timer_init(&ts[i].timer, tw_test_cb, &ts[i]);
+        ts[i].tw = tw;
+        ts[i].fired = 0;
+        ts[i].late = 0;
+        uint64_t delay = rand() % TW_TEST_SPAN;
+        ts[i].due = tw->jiffies + delay;
+        timer_wheel_add(tw, &ts[i].timer, delay);
+    }
+    for (int i = 0; i < TW_TEST_TIMERS; i += 4) {
+        timer_wheel_del(tw, &ts[i].timer);
+        cancelled++;
+    }
+    uint64_t start = get_time_ns();
+    while (tw->pending > 0) {
+        timer_wheel_advance(tw, 1 + rand() % 3000);
+    }
+    uint64_t cost = get_time_ns() - start;
+    for (int i = 0; i < TW_TEST_TIMERS; i++) {
+        fired += ts[i].fired;
+        late += ts[i].late;
+        twice += ts[i].fired > 1;
+        if (i % 4 == 0 && ts[i].fired) {
+            printf("cancelled timer %d fired\n", i);
+            errors++;
+        }
+    }
+    printf("simulated: %d fired, %d cancelled, %d off tick, %d twice, "
+           "%.1f ns/timer\n",
+           fired, cancelled, late, twice, (double)cost / TW_TEST_TIMERS);
+    errors += late != 0 || twice != 0 || fired != TW_TEST_TIMERS - cancelled;
+
+    /* real time: 1ms ticks, the thread sleeps between busy ticks */
+    timer_wheel_init(tw, 1000);
+    tw_idle_fired = 0;
+    for (int i = 0; i < TW_IDLE_TIMERS; i++) {
+        tw_timer_init(&ts[i].timer, tw_idle_cb, NULL);
+        timer_wheel_add(tw, &ts[i].timer, rand() % TW_IDLE_SPAN_MS);
+    }
+    /* a few far timeouts keep the wheel mostly idle at the end */
+    for (int i = TW_IDLE_TIMERS; i < TW_IDLE_TIMERS + 3; i++) {
+        tw_timer_init(&ts[i].timer, tw_idle_cb, NULL);
+        timer_wheel_add(tw, &ts[i].timer, 2000 + (i - TW_IDLE_TIMERS) * 500);
+    }
+    clock_t cpu = clock();
+    start = get_time_ns();
+    int wakeups = 0;
+    while (tw->pending > 0) {
+        timer_wheel_sleep(tw, 1000);
+        wakeups++;
+    }
+    printf("real time: %d fired, %d wakeups, wall %.0f ms, cpu %.0f ms\n",
+           tw_idle_fired, wakeups, (get_time_ns() - start) / 1e6,
+           (clock() - cpu) * 1000.0 / CLOCKS_PER_SEC);
+    errors += tw_idle_fired != TW_IDLE_TIMERS + 3;
+
+    /* nothing pending, even with no cap it must not sleep */
+    start = get_time_ns();
+    timer_wheel_sleep(tw, UINT64_MAX);
+    printf("empty sleep: %.3f ms\n", (get_time_ns() - start) / 1e6);
+
+    /* timerfd for event loops */
+    int fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+    if (fd < 0) {
+        printf("timerfd_create failed.\n");
+        free(ts);
+        free(tw);
+        return -1;
+    }
+    uint64_t expirations;
+    timer_wheel_init(tw, 1000);
+    tw_idle_fired = 0;
+    tw_timer_init(&ts[0].timer, tw_idle_cb, NULL);
+    timer_wheel_add(tw, &ts[0].timer, 50);
+    start = get_time_ns();
+    timer_wheel_arm_timerfd(tw, fd);
+    if (read(fd, &expirations, sizeof(expirations)) != sizeof(expirations)) {
+        printf("timerfd read failed.\n");
+        errors++;
+    } else {
+        timer_wheel_poll(tw);
+        printf("timerfd: fired=%d after %.1f ms\n", tw_idle_fired,
+               (get_time_ns() - start) / 1e6);
+        errors += tw_idle_fired != 1;
+    }
+    close(fd);
+
+    free(ts);
+    free(tw);
+    return errors > 0 ? -1 : 0;
+}
@@ -0,0 +1,221 @@
+/**
+ * @file test_unrolled_list.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief unrolled list api test and traversal benchmark against a plain
+ * singly list (struct node in test_list.c) and utlist
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "utlist.h"
+#include "unrolled_list.h"
+#include "test.h"
+
+#define BENCH_LIST_LEN 1000000
+#define BENCH_LIST_ROUNDS 20
+
+/* same layout as struct node in test_list.c */
+typedef struct snode {
+    int data;
+    struct snode *next;
+} snode_t;
+
+/* utlist element */
+typedef struct el {
+    int data;
+    struct el *next;
+} el_t;
+
+/* link nodes in random order, a long lived heap rarely hands out
+   neighbouring addresses to neighbouring list nodes */
+static void shuffle_ptrs(void **arr, int n)
+{
+    for (int i = n - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        void *t = arr[i];
+        arr[i] = arr[j];
+        arr[j] = t;
+    }
+}
+
+/* size and every element against the plain array */
+static int ulist_same(const ulist_t *list, const int *ref, size_t n)
+{
+    int val;
+
+    if (ulist_size(list) != n) {
+        return 1;
+    }
+    for (size_t i = 0; i < n; i++) {
+        if (ulist_get(list, i, &val) != 0 || val != ref[i]) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int ulist_api_test(void)
+{
+    ulist_t list;
+    int ref[64];
+    size_t n = 0;
+    int val, errors = 0;
+
+    ulist_init(&list);
+    for (int i = 0; i < 40; i++) {
+        ulist_push_back(&list, i);
+        ref[n++] = i;
+    }
+    errors += ulist_same(&list, ref, n);
+
+    ulist_push_front(&list, -1);
+    memmove(ref + 1, ref, sizeof(int) * n++);
+    ref[0] = -1;
+    errors += ulist_same(&list, ref, n);
+
+    ulist_insert(&list, 5, 100);
+    memmove(ref + 6, ref + 5, sizeof(int) * (n++ - 5));
+    ref[5] = 100;
+    ulist_insert(&list, ulist_size(&list), 200);
+    ref[n++] = 200;
+    errors += ulist_same(&list, ref, n);
+
+    errors += ulist_remove_at(&list, 0, &val) != 0 || val != -1;
+    memmove(ref, ref + 1, sizeof(int) * --n);
+    errors += ulist_same(&list, ref, n);
+
+    errors += ulist_remove(&list, 100) != true;
+    errors += ulist_remove(&list, 1000) != false;
+    memmove(ref + 4, ref + 5, sizeof(int) * (--n - 4));
+    errors += ulist_same(&list, ref, n);
+
+    for (int i = 0; i < 30; i++) {
+        ulist_remove_at(&list, 3, NULL);
+    }
+    memmove(ref + 3, ref + 33, sizeof(int) * (n - 33));
+    n -= 30;
+    errors += ulist_same(&list, ref, n);
+    errors += ulist_size(&list) != 11;
+    errors += ulist_get(&list, 3, &val) != 0 || val != 33;
+    errors += ulist_get(&list, n, &val) != -1;
+    if (errors > 0) {
+        printf("unrolled_list: %d api steps went wrong, list is:\n", errors);
+        ulist_print(&list);
+    }
+    ulist_destroy(&list);
+    return errors;
+}
+
+static long long bench_snode(void **nodes, int n, bool shuffled)
+{
+    long long sum = 0;
+
+    for (int i = 0; i < n; i++) {
+        snode_t *node = (snode_t *)malloc(sizeof(snode_t));
+        node->data = i;
+        nodes[i] = node;
+    }
+    if (shuffled) {
+        shuffle_ptrs(nodes, n);
+    }
+    for (int i = 0; i < n; i++) {
+        snode_t *next = i + 1 < n ? (snode_t *)nodes[i + 1] : NULL;
+        ((snode_t *)nodes[i])->next = next;
+    }
+    snode_t *shead = (snode_t *)nodes[0];
+
+    uint64_t start = get_time_ns();
+    for (int r = 0; r < BENCH_LIST_ROUNDS; r++) {
+        for (snode_t *cur = shead; cur != NULL; cur = cur->next) {
+            sum += cur->data;
+        }
+    }
+    printf("struct node  %s: %8.2f ns/elem\n",
+           shuffled ? "shuffled  " : "sequential",
+           (double)(get_time_ns() - start) / n / BENCH_LIST_ROUNDS);
+    for (int i = 0; i < n; i++) {
+        free(nodes[i]);
+    }
+    return sum;
+}
+
+static long long bench_utlist(void **nodes, int n, bool shuffled)
+{
+    long long sum = 0;
+    el_t *ehead = NULL;
+    el_t *elt;
+
+    for (int i = 0; i < n; i++) {
+        el_t *e = (el_t *)malloc(sizeof(el_t));
+        e->data = i;
+        nodes[i] = e;
+    }
+    if (shuffled) {
+        shuffle_ptrs(nodes, n);
+    }
+    for (int i = n - 1; i >= 0; i--) {
+        LL_PREPEND(ehead, (el_t *)nodes[i]);
+    }
+
+    uint64_t start = get_time_ns();
+    for (int r = 0; r < BENCH_LIST_ROUNDS; r++) {
+        LL_FOREACH(ehead, elt)
+        {
+            sum += elt->data;
+        }
+    }
+    printf("utlist       %s: %8.2f ns/elem\n",
+           shuffled ? "shuffled  " : "sequential",
+           (double)(get_time_ns() - start) / n / BENCH_LIST_ROUNDS);
+    for (int i = 0; i < n; i++) {
+        free(nodes[i]);
+    }
+    return sum;
+}
+
+int test_unrolled_list(void)
+{
+    int n = BENCH_LIST_LEN;
+    void **nodes = (void **)malloc(sizeof(void *) * n);
+    long long want = (long long)n * (n - 1) / 2 * BENCH_LIST_ROUNDS;
+    int errors = ulist_api_test();
+
+    /* sequential is the freshly malloced order the ulist nodes get too,
+       shuffled is what a long lived heap tends to hand out */
+    for (int shuffled = 0; shuffled < 2; shuffled++) {
+        errors += bench_snode(nodes, n, shuffled) != want;
+        errors += bench_utlist(nodes, n, shuffled) != want;
+    }
+
+    /* unrolled list */
+    ulist_t list;
+    ulist_node_t *node;
+    int i;
+    ulist_init(&list);
+    for (i = 0; i < n; i++) {
+        ulist_push_back(&list, i);
+    }
+
+    long long sum = 0;
+    uint64_t start = get_time_ns();
+    for (int r = 0; r < BENCH_LIST_ROUNDS; r++) {
+        ULIST_FOREACH(&list, node, i)
+        {
+            sum += node->data[i];
+        }
+    }
+    printf("ulist (%2d/n) sequential: %8.2f ns/elem\n", ULIST_NODE_CAP,
+           (double)(get_time_ns() - start) / n / BENCH_LIST_ROUNDS);
+    errors += sum != want;
+    ulist_destroy(&list);
+
+    free(nodes);
+    return errors > 0 ? -1 : 0;
+}
@@ -0,0 +1,222 @@
+/**
+ * @file aho_corasick.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "aho_corasick.h"
+
+void ac_init(ac_t *ac, int flags)
+{
+    memset(ac, 0, sizeof(ac_t));
+    ac->flags = flags;
+}
+
+static void free_patterns(ac_t *ac)
+{
+    free(ac->buf);
+    free(ac->pat_off);
+    free(ac->pat_len);
+    ac->buf = NULL;
+    ac->pat_off = NULL;
+    ac->pat_len = NULL;
+}
+
+void ac_destroy(ac_t *ac)
+{
+    free_patterns(ac);
+    free(ac->delta);
+    free(ac->out);
+    free(ac->emit);
+    free(ac->dict);
+    free(ac->depth);
+    memset(ac, 0, sizeof(ac_t));
+}
+
+int ac_add(ac_t *ac, const char *pat, size_t len)
+{
+    if (ac->built || len == 0 || len > UINT32_MAX) {
+        return -1;
+    }
+    if (ac->num_pats == ac->pats_cap) {
+        int cap = ac->pats_cap ? ac->pats_cap * 2 : 16;
+        size_t *off = (size_t *)realloc(ac->pat_off, sizeof(size_t) * cap);
+        if (off == NULL) {
+            printf("Memory allocation failed.\n");
+            return -1;
+        }
+        ac->pat_off = off;
+        uint32_t *lens =
+            (uint32_t *)realloc(ac->pat_len, sizeof(uint32_t) * cap);
+        if (lens == NULL) {
+            printf("Memory allocation failed.\n");
+            return -1;
+        }
+        ac->pat_len = lens;
+        ac->pats_cap = cap;
+    }
+    if (ac->buf_len + len > ac->buf_cap) {
+        size_t cap = ac->buf_cap ? ac->buf_cap : 256;
+        while (cap < ac->buf_len + len) {
+            cap *= 2;
+        }
+        char *buf = (char *)realloc(ac->buf, cap);
+        if (buf == NULL) {
+            printf("Memory allocation failed.\n");
+            return -1;
+        }
+        ac->buf = buf;
+        ac->buf_cap = cap;
+    }
+    memcpy(ac->buf + ac->buf_len, pat, len);
+    ac->pat_off[ac->num_pats] = ac->buf_len;
+    ac->pat_len[ac->num_pats] = (uint32_t)len;
+    ac->buf_len += len;
+    return ac->num_pats++;
+}
+
+/* one column per distinct pattern byte, column 0 for the rest, so the
+   table of a lowercase dictionary is 27 wide instead of 256 */
+static void build_classes(ac_t *ac)
+{
+    bool used[256] = {false};
+    bool icase = ac->flags & AC_ICASE;
+
+    for (size_t i = 0; i < ac->buf_len; i++) {
+        unsigned char c = ac->buf[i];
+        used[icase ? tolower(c) : c] = true;
+    }
+    memset(ac->cls, 0, sizeof(ac->cls));
+    ac->stride = 1;
+    for (int c = 0; c < 256; c++) {
+        if (used[c] && !(icase && isupper(c))) {
+            ac->cls[c] = (uint16_t)ac->stride++;
+        }
+    }
+    if (icase) {
+        for (int c = 'A'; c <= 'Z'; c++) {
+            ac->cls[c] = ac->cls[tolower(c)];
+        }
+    }
+}
+
+int ac_build(ac_t *ac)
+{
+    if (ac->built) {
+        return -1;
+    }
+    build_classes(ac);
+
+    /* trie first, a zero entry means no child since the root is no child */
+    size_t max_states = ac->buf_len + 1;
+    int stride = ac->stride;
+    ac->delta = (int32_t *)calloc(max_states * stride, sizeof(int32_t));
+    ac->out = (int32_t *)malloc(sizeof(int32_t) * max_states);
+    ac->emit = (int32_t *)malloc(sizeof(int32_t) * max_states);
+    ac->dict = (int32_t *)malloc(sizeof(int32_t) * max_states);
+    ac->depth = (uint32_t *)malloc(sizeof(uint32_t) * max_states);
+    int32_t *fail = (int32_t *)malloc(sizeof(int32_t) * max_states);
+    if (ac->delta == NULL || ac->out == NULL || ac->emit == NULL ||
+        ac->dict == NULL || ac->depth == NULL || fail == NULL) {
+        printf("Memory allocation failed.\n");
+        free(fail);
+        return -1;
+    }
+    ac->num_states = 1;
+    ac->out[0] = -1;
+    ac->depth[0] = 0;
+    for (int id = 0; id < ac->num_pats; id++) {
+        const unsigned char *p =
+            (const unsigned char *)ac->buf + ac->pat_off[id];
+        int32_t s = 0;
+        for (uint32_t i = 0; i < ac->pat_len[id]; i++) {
+            int32_t *next = &ac->delta[s * stride + ac->cls[p[i]]];
+            if (*next == 0) {
+                *next = ac->num_states;
+                ac->out[*next] = -1;
+                ac->depth[*next] = i + 1;
+                ac->num_states++;
+            }
+            s = *next;
+        }
+        if (ac->out[s] < 0) {
+            ac->out[s] = id;
+        }
+    }
+    /* shared prefixes leave the tail of the table unused */
+    int32_t *delta = (int32_t *)realloc(
+        ac->delta, sizeof(int32_t) * ac->num_states * stride);
+    if (delta != NULL) {
+        ac->delta = delta;
+    }
+
+    /* breadth first, so the fail state's row is complete before it is
+       copied into the missing entries of this row, and its emit is set */
+    int32_t *queue = (int32_t *)malloc(sizeof(int32_t) * ac->num_states);
+    if (queue == NULL) {
+        printf("Memory allocation failed.\n");
+        free(fail);
+        return -1;
+    }
+    int head = 0, tail = 0;
+    ac->emit[0] = -1;
+    ac->dict[0] = -1;
+    for (int c = 1; c < stride; c++) {
+        int32_t child = ac->delta[c];
+        if (child != 0) {
+            fail[child] = 0;
+            ac->dict[child] = -1;
+            ac->emit[child] = ac->out[child] >= 0 ? child : -1;
+            queue[tail++] = child;
+        }
+    }
+    while (head < tail) {
+        int32_t s = queue[head++];
+        int32_t *row = &ac->delta[s * stride];
+        const int32_t *frow = &ac->delta[fail[s] * stride];
+        for (int c = 0; c < stride; c++) {
+            int32_t child = row[c];
+            if (child == 0) {
+                row[c] = frow[c];
+                continue;
+            }
+            fail[child] = frow[c];
+            ac->dict[child] = ac->emit[fail[child]];
+            ac->emit[child] = ac->out[child] >= 0 ? child : ac->dict[child];
+            queue[tail++] = child;
+        }
+    }
+    free(queue);
+    free(fail);
+    free_patterns(ac);
+    ac->built = true;
+    return 0;
+}
+
+size_t ac_scan(const ac_t *ac, const char *text, size_t len, ac_match_cb cb,
+               void *arg)
+{
+    const unsigned char *t = (const unsigned char *)text;
+    size_t matches = 0;
+    int32_t s = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        s = ac_step(ac, s, t[i]);
+        for (int32_t x = ac->emit[s]; x >= 0; x = ac->dict[x]) {
+            matches++;
+            if (cb != NULL && cb(arg, ac->out[x], i + 1)) {
+                return matches;
+            }
+        }
+    }
+    return matches;
+}
@@ -0,0 +1,128 @@
+/**
+ * @file aho_corasick.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief Aho-Corasick multi-pattern matcher, a flat DFA over the byte
+ * classes the patterns use, one table lookup per text byte
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _AHO_CORASICK_H_
+#define _AHO_CORASICK_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AC_ICASE 0x1 /* ASCII letters match either case */
+
+typedef struct {
+    int flags;
+    bool built;
+    /* patterns, kept until ac_build */
+    char *buf;
+    size_t buf_len;
+    size_t buf_cap;
+    size_t *pat_off;
+    uint32_t *pat_len;
+    int num_pats;
+    int pats_cap;
+    /* automaton, state 0 is the root */
+    /* byte -> column, 0 for bytes in no pattern, up to 256 columns past
+       it when every byte value is used */
+    uint16_t cls[256];
+    int stride; /* columns per state */
+    int num_states;
+    int32_t *delta; /* num_states * stride, goto and fail folded */
+    int32_t *out; /* lowest pattern id ending exactly here, -1 if none */
+    int32_t *emit; /* first state with output on the suffix chain, -1 */
+    int32_t *dict; /* next state with output below this one, -1 */
+    uint32_t *depth;
+} ac_t;
+
+/* return non-zero to stop the scan */
+typedef int (*ac_match_cb)(void *arg, int id, size_t end);
+
+/**
+ * @brief init an empty matcher
+ *
+ * @param ac
+ * @param flags 0 or AC_ICASE
+ */
+void ac_init(ac_t *ac, int flags);
+
+/**
+ * @brief free everything, ac can be reused after ac_init
+ *
+ * @param ac
+ */
+void ac_destroy(ac_t *ac);
+
+/**
+ * @brief add a pattern before ac_build, duplicates report the lowest id
+ *
+ * @param ac
+ * @param pat
+ * @param len >= 1
+ * @return int pattern id, -1 on error
+ */
+int ac_add(ac_t *ac, const char *pat, size_t len);
+
+/**
+ * @brief build the automaton, O(total pattern length * columns)
+ *
+ * @param ac
+ * @return int 0 on success, -1 on error
+ */
+int ac_build(ac_t *ac);
+
+/**
+ * @brief feed one byte
+ *
+ * @param ac
+ * @param state 0 to start
+ * @param c
+ * @return int next state
+ */
+static inline int ac_step(const ac_t *ac, int state, unsigned char c)
+{
+    return ac->delta[state * ac->stride + ac->cls[c]];
+}
+
+/**
+ * @brief id of the pattern equal to all len bytes fed since state 0
+ *
+ * @param ac
+ * @param state
+ * @param len bytes fed
+ * @return int -1 if those bytes are not a pattern
+ */
+static inline int ac_exact(const ac_t *ac, int state, size_t len)
+{
+    return ac->depth[state] == len ? ac->out[state] : -1;
+}
+
+/**
+ * @brief report every occurrence of every pattern, O(len + matches)
+ *
+ * @param ac
+ * @param text
+ * @param len
+ * @param cb called with the pattern id and the end offset of the match
+ * @param arg
+ * @return size_t number of matches reported
+ */
+size_t ac_scan(const ac_t *ac, const char *text, size_t len, ac_match_cb cb,
+               void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,119 @@
+/**
+ * @file arena.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+
+void arena_init(arena_t *a, size_t block_size, int flags)
+{
+    arena_init_buffer(a, NULL, 0, flags);
+    a->block_size = block_size ? block_size : ARENA_BLOCK_SIZE;
+}
+
+void arena_init_buffer(arena_t *a, void *buf, size_t size, int flags)
+{
+    memset(a, 0, sizeof(arena_t));
+    a->first.base = (char *)buf;
+    a->first.size = size;
+    a->head = &a->first;
+    a->block_size = ARENA_BLOCK_SIZE;
+    a->flags = flags;
+}
+
+/* frees the heap blocks newer than stop, keeping the largest as spare */
+static void release(arena_t *a, arena_block_t *stop)
+{
+    while (a->head != stop) {
+        arena_block_t *b = a->head;
+        a->head = b->prev;
+        if (a->spare == NULL || a->spare->size < b->size) {
+            free(a->spare);
+            a->spare = b;
+        } else {
+            free(b);
+        }
+    }
+}
+
+void arena_destroy(arena_t *a)
+{
+    release(a, &a->first);
+    free(a->spare);
+    memset(a, 0, sizeof(arena_t));
+}
+
+static arena_block_t *grow(arena_t *a, size_t size, size_t align)
+{
+    if (a->flags & ARENA_NO_GROW) {
+        return NULL;
+    }
+    /* the header is followed by the data, size + align covers any shift */
+    size_t need = size + align;
+    arena_block_t *b = a->spare;
+    if (b != NULL && b->size >= need) {
+        a->spare = NULL;
+    } else {
+        size_t bytes = need > a->block_size ? need : a->block_size;
+        b = (arena_block_t *)malloc(sizeof(arena_block_t) + bytes);
+        if (b == NULL) {
+            printf("Memory allocation failed.\n");
+            return NULL;
+        }
+        b->base = (char *)(b + 1);
+        b->size = bytes;
+    }
+    b->used = 0;
+    b->prev = a->head;
+    a->head = b;
+    return b;
+}
+
+void *arena_alloc_aligned(arena_t *a, size_t size, size_t align)
+{
+    arena_block_t *b = a->head;
+    uintptr_t p = (uintptr_t)(b->base + b->used);
+    size_t pad = (align - (p & (align - 1))) & (align - 1);
+
+    if (b->base == NULL || pad + size > b->size - b->used) {
+        b = grow(a, size, align);
+        if (b == NULL) {
+            return NULL;
+        }
+        p = (uintptr_t)b->base;
+        pad = (align - (p & (align - 1))) & (align - 1);
+    }
+    b->used += pad + size;
+    return (void *)(p + pad);
+}
+
+char *arena_strndup(arena_t *a, const char *s, size_t len)
+{
+    char *d = (char *)arena_alloc_aligned(a, len + 1, 1);
+    if (d != NULL) {
+        memcpy(d, s, len);
+        d[len] = '\0';
+    }
+    return d;
+}
+
+void arena_pop(arena_t *a, arena_mark_t mark)
+{
+    release(a, mark.block);
+    a->head->used = mark.used;
+}
+
+void arena_reset(arena_t *a)
+{
+    release(a, &a->first);
+    a->first.used = 0;
+}
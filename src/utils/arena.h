@@ -0,0 +1,143 @@
+/**
+ * @file arena.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief bump pointer arena for memory whose lifetimes end together,
+ * marks to release everything allocated after a point, optionally over a
+ * caller buffer with growth onto the heap
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _ARENA_H_
+#define _ARENA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ARENA_ALIGN 16 /* alignment of arena_alloc */
+#define ARENA_BLOCK_SIZE 4096 /* default heap block */
+
+/* flags */
+#define ARENA_NO_GROW 0x1 /* fail instead of allocating heap blocks */
+
+typedef struct arena_block {
+    struct arena_block *prev; /* older block, NULL for the first */
+    char *base;
+    size_t size;
+    size_t used;
+} arena_block_t;
+
+/* head may point into the arena itself, so it is not copied or moved */
+typedef struct {
+    arena_block_t *head; /* block being bumped */
+    arena_block_t *spare; /* released heap block kept for reuse */
+    arena_block_t first; /* caller buffer, or empty */
+    size_t block_size;
+    int flags;
+} arena_t;
+
+/* position to go back to, valid while the blocks it names are alive */
+typedef struct {
+    arena_block_t *block;
+    size_t used;
+} arena_mark_t;
+
+/**
+ * @brief arena over heap blocks
+ *
+ * @param a
+ * @param block_size 0 for ARENA_BLOCK_SIZE, larger requests get a block of
+ * their own
+ * @param flags
+ */
+void arena_init(arena_t *a, size_t block_size, int flags);
+
+/**
+ * @brief arena that bumps through buf first, a stack buffer keeps small
+ * calls off the heap entirely
+ *
+ * @param a
+ * @param buf
+ * @param size
+ * @param flags ARENA_NO_GROW to never go past buf
+ */
+void arena_init_buffer(arena_t *a, void *buf, size_t size, int flags);
+
+/**
+ * @brief free the heap blocks, buf of arena_init_buffer is the caller's
+ *
+ * @param a
+ */
+void arena_destroy(arena_t *a);
+
+/**
+ * @brief size bytes aligned to align
+ *
+ * @param a
+ * @param size
+ * @param align power of two
+ * @return void* NULL when out of memory, or past buf with ARENA_NO_GROW
+ */
+void *arena_alloc_aligned(arena_t *a, size_t size, size_t align);
+
+/**
+ * @brief size bytes aligned to ARENA_ALIGN
+ *
+ * @param a
+ * @param size
+ * @return void*
+ */
+static inline void *arena_alloc(arena_t *a, size_t size)
+{
+    return arena_alloc_aligned(a, size, ARENA_ALIGN);
+}
+
+/**
+ * @brief copy of the first len bytes of s, NUL terminated, byte aligned
+ *
+ * @param a
+ * @param s
+ * @param len
+ * @return char*
+ */
+char *arena_strndup(arena_t *a, const char *s, size_t len);
+
+/**
+ * @brief current position, see arena_pop
+ *
+ * @param a
+ * @return arena_mark_t
+ */
+static inline arena_mark_t arena_mark(const arena_t *a)
+{
+    arena_mark_t m = {a->head, a->head->used};
+    return m;
+}
+
+/**
+ * @brief release everything allocated after mark, one heap block is kept
+ * so a loop of mark, alloc, pop does not call malloc again
+ *
+ * @param a
+ * @param mark
+ */
+void arena_pop(arena_t *a, arena_mark_t mark);
+
+/**
+ * @brief release everything
+ *
+ * @param a
+ */
+void arena_reset(arena_t *a);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,416 @@
+/**
+ * @file bignum.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "bignum.h"
+
+#define DEC_BASE 1000000000000000000ULL
+#define DEC_DIGITS 18
+
+static const char digit_pairs[201] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+void bn_init(bignum_t *x, bn_radix_t radix)
+{
+    memset(x, 0, sizeof(bignum_t));
+    x->radix = radix;
+}
+
+void bn_destroy(bignum_t *x)
+{
+    free(x->limb);
+    bn_init(x, x->radix);
+}
+
+static int reserve(bignum_t *x, size_t len)
+{
+    if (len <= x->cap) {
+        return 0;
+    }
+    size_t cap = x->cap ? x->cap : 4;
+    while (cap < len) {
+        cap *= 2;
+    }
+    uint64_t *limb = (uint64_t *)realloc(x->limb, sizeof(uint64_t) * cap);
+    if (limb == NULL) {
+        printf("Memory allocation failed.\n");
+        return -1;
+    }
+    x->limb = limb;
+    x->cap = cap;
+    return 0;
+}
+
+static void trim(bignum_t *x)
+{
+    while (x->len > 0 && x->limb[x->len - 1] == 0) {
+        x->len--;
+    }
+}
+
+/* all 8 bytes are '0'..'9', high nibble 3 and low nibble at most 9, the
+   + 6 pushes 10..15 into the high nibble */
+static inline bool valid8_dec(uint64_t x)
+{
+    return ((x & 0xF0F0F0F0F0F0F0F0ULL) |
+            ((x + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4) ==
+           0x3333333333333333ULL;
+}
+
+static inline bool valid8_bin(uint64_t x)
+{
+    return (x & 0xFEFEFEFEFEFEFEFEULL) == 0x3030303030303030ULL;
+}
+
+/* 8 ASCII digits, most significant first, in a few multiplies */
+static inline uint64_t parse8_dec(uint64_t x)
+{
+    x -= 0x3030303030303030ULL;
+    x = (x * 10 + (x >> 8)) & 0x00FF00FF00FF00FFULL;
+    x = (x * 100 + (x >> 16)) & 0x0000FFFF0000FFFFULL;
+    return (x * 10000 + (x >> 32)) & 0xFFFFFFFFULL;
+}
+
+/* 8 ASCII bits, most significant first, into one byte */
+static inline uint64_t parse8_bin(uint64_t x)
+{
+    x -= 0x3030303030303030ULL;
+    return (x * 0x8040201008040201ULL) >> 56;
+}
+
+int bn_parse(bignum_t *x, const char *s, size_t n)
+{
+    bool dec = x->radix == BN_DECIMAL;
+    size_t per = dec ? DEC_DIGITS : 64;
+    char max = dec ? '9' : '1';
+    bool ok = true;
+
+    if (reserve(x, (n + per - 1) / per) != 0) {
+        return -1;
+    }
+    x->len = 0;
+    /* limbs from the least significant end, the first one may be short,
+       digits are checked 8 at a time on the way */
+    for (size_t end = n; end > 0;) {
+        size_t start = end > per ? end - per : 0;
+        const char *p = s + start;
+        size_t len = end - start;
+        size_t head = len % 8;
+        uint64_t v = 0;
+        for (size_t i = 0; i < head; i++) {
+            ok &= p[i] >= '0' && p[i] <= max;
+            v = v * (dec ? 10 : 2) + (uint64_t)(p[i] - '0');
+        }
+        for (size_t i = head; i < len; i += 8) {
+            uint64_t w;
+            memcpy(&w, p + i, 8);
+            if (dec) {
+                ok &= valid8_dec(w);
+                v = v * 100000000ULL + parse8_dec(w);
+            } else {
+                ok &= valid8_bin(w);
+                v = (v << 8) | parse8_bin(w);
+            }
+        }
+        x->limb[x->len++] = v;
+        end = start;
+    }
+    trim(x);
+    return ok ? 0 : -1;
+}
+
+int bn_add_small(bignum_t *x, uint64_t v)
+{
+    uint64_t base_max = x->radix == BN_DECIMAL ? DEC_BASE - 1 : UINT64_MAX;
+
+    if (reserve(x, x->len + 1) != 0) {
+        return -1;
+    }
+    /* the carry stops at the first limb that is not all nines or ones */
+    for (size_t i = 0; v != 0; i++) {
+        if (i == x->len) {
+            x->limb[x->len++] = v;
+            break;
+        }
+        uint64_t room = base_max - x->limb[i];
+        if (v <= room) {
+            x->limb[i] += v;
+            break;
+        }
+        x->limb[i] = v - room - 1;
+        v = 1;
+    }
+    return 0;
+}
+
+int bn_add(bignum_t *r, const bignum_t *a, const bignum_t *b)
+{
+    if (a->len < b->len) {
+        const bignum_t *t = a;
+        a = b;
+        b = t;
+    }
+    size_t na = a->len, nb = b->len;
+    if (reserve(r, na + 1) != 0) {
+        return -1;
+    }
+    /* re-read after reserve, r may be a or b */
+    const uint64_t *x = a->limb, *y = b->limb;
+    uint64_t *z = r->limb;
+    uint64_t carry = 0;
+    size_t i = 0;
+    if (r->radix == BN_DECIMAL) {
+        for (; i < nb; i++) {
+            uint64_t s = x[i] + y[i] + carry;
+            carry = s >= DEC_BASE;
+            z[i] = carry ? s - DEC_BASE : s;
+        }
+        for (; i < na; i++) {
+            uint64_t s = x[i] + carry;
+            carry = s >= DEC_BASE;
+            z[i] = carry ? s - DEC_BASE : s;
+        }
+    } else {
+        for (; i < nb; i++) {
+            uint64_t s = x[i] + carry;
+            uint64_t c = s < carry;
+            s += y[i];
+            carry = c | (s < y[i]);
+            z[i] = s;
+        }
+        for (; i < na; i++) {
+            uint64_t s = x[i] + carry;
+            carry = s < carry;
+            z[i] = s;
+        }
+    }
+    z[na] = carry;
+    r->len = na + 1;
+    trim(r);
+    return 0;
+}
+
+int bn_cmp(const bignum_t *a, const bignum_t *b)
+{
+    if (a->len != b->len) {
+        return a->len < b->len ? -1 : 1;
+    }
+    for (size_t i = a->len; i > 0; i--) {
+        if (a->limb[i - 1] != b->limb[i - 1]) {
+            return a->limb[i - 1] < b->limb[i - 1] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+int bn_sub(bignum_t *r, const bignum_t *a, const bignum_t *b)
+{
+    if (bn_cmp(a, b) < 0) {
+        return -1;
+    }
+    size_t na = a->len, nb = b->len;
+    if (reserve(r, na) != 0) {
+        return -1;
+    }
+    const uint64_t *x = a->limb, *y = b->limb;
+    uint64_t *z = r->limb;
+    uint64_t borrow = 0;
+    uint64_t base = r->radix == BN_DECIMAL ? DEC_BASE : 0; /* 0 is 2^64 */
+    for (size_t i = 0; i < na; i++) {
+        uint64_t sub = (i < nb ? y[i] : 0) + borrow;
+        uint64_t xi = x[i];
+        /* sub can only wrap to 0 in base 2^64, y[i] = 2^64 - 1, borrow 1 */
+        borrow = xi < sub || (borrow && sub == 0);
+        z[i] = xi - sub + (borrow ? base : 0);
+    }
+    r->len = na;
+    trim(r);
+    return 0;
+}
+
+/* 64 x 64 bit product as two halves, __int128 is missing on 32-bit
+   targets */
+static inline uint64_t mul_wide(uint64_t a, uint64_t b, uint64_t *hi)
+{
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 p = (unsigned __int128)a * b;
+    *hi = (uint64_t)(p >> 64);
+    return (uint64_t)p;
+#else
+    uint64_t al = (uint32_t)a, ah = a >> 32;
+    uint64_t bl = (uint32_t)b, bh = b >> 32;
+    uint64_t ll = al * bl, lh = al * bh, hl = ah * bl;
+    uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+    *hi = ah * bh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    return (mid << 32) | (uint32_t)ll;
+#endif
+}
+
+/* a * b + c + d of decimal limbs as a high and a low limb, split into 9
+   digit halves so every partial product fits in 64 bits */
+static inline uint64_t mul_dec(uint64_t a, uint64_t b, uint64_t c,
+                               uint64_t d, uint64_t *hi)
+{
+    const uint64_t half = 1000000000ULL;
+    uint64_t ah = a / half, al = a % half;
+    uint64_t bh = b / half, bl = b % half;
+    uint64_t mid = ah * bl + al * bh; /* below 2 * 10^18 */
+    uint64_t lo = al * bl + mid % half * half + c + d; /* below 4 * 10^18 */
+
+    *hi = ah * bh + mid / half + lo / DEC_BASE;
+    return lo % DEC_BASE;
+}
+
+int bn_mul(bignum_t *r, const bignum_t *a, const bignum_t *b)
+{
+    size_t na = a->len, nb = b->len;
+
+    if (na == 0 || nb == 0) {
+        r->len = 0;
+        return 0;
+    }
+    if (reserve(r, na + nb) != 0) {
+        return -1;
+    }
+    uint64_t *z = r->limb;
+    memset(z, 0, sizeof(uint64_t) * (na + nb));
+    for (size_t i = 0; i < na; i++) {
+        uint64_t carry = 0;
+        uint64_t xi = a->limb[i];
+        for (size_t j = 0; j < nb; j++) {
+            if (r->radix == BN_DECIMAL) {
+                z[i + j] = mul_dec(xi, b->limb[j], z[i + j], carry, &carry);
+            } else {
+                uint64_t hi;
+                uint64_t lo = mul_wide(xi, b->limb[j], &hi);
+                lo += z[i + j];
+                hi += lo < z[i + j];
+                lo += carry;
+                hi += lo < carry;
+                z[i + j] = lo;
+                carry = hi;
+            }
+        }
+        z[i + nb] = carry;
+    }
+    r->len = na + nb;
+    trim(r);
+    return 0;
+}
+
+static int top_digits(const bignum_t *x)
+{
+    uint64_t top = x->limb[x->len - 1];
+    int d = 1;
+
+    if (x->radix == BN_BINARY) {
+        return 64 - __builtin_clzll(top);
+    }
+    while (top >= 10) {
+        top /= 10;
+        d++;
+    }
+    return d;
+}
+
+size_t bn_digits(const bignum_t *x)
+{
+    if (x->len == 0) {
+        return 1;
+    }
+    size_t per = x->radix == BN_DECIMAL ? DEC_DIGITS : 64;
+    return per * (x->len - 1) + top_digits(x);
+}
+
+/* 9 digits as one digit and four pairs, the pair lookups do not depend
+   on each other */
+static inline void format9(uint32_t v, char *out)
+{
+    uint32_t lo = v % 100000000;
+    uint32_t a = lo / 10000, b = lo % 10000;
+
+    out[0] = (char)('0' + v / 100000000);
+    memcpy(out + 1, digit_pairs + 2 * (a / 100), 2);
+    memcpy(out + 3, digit_pairs + 2 * (a % 100), 2);
+    memcpy(out + 5, digit_pairs + 2 * (b / 100), 2);
+    memcpy(out + 7, digit_pairs + 2 * (b % 100), 2);
+}
+
+/* full 18 digit limb */
+static inline void format18(uint64_t v, char *out)
+{
+    format9((uint32_t)(v / 1000000000), out);
+    format9((uint32_t)(v % 1000000000), out + 9);
+}
+
+/* byte to 8 ASCII bits, most significant first */
+static inline void format8_bin(uint64_t b, char *out)
+{
+    uint64_t x = (b * 0x0101010101010101ULL) & 0x0102040810204080ULL;
+    x = ((x + 0x7F7F7F7F7F7F7F7FULL) & 0x8080808080808080ULL) >> 7;
+    x += 0x3030303030303030ULL;
+    memcpy(out, &x, 8);
+}
+
+size_t bn_format(const bignum_t *x, char *out)
+{
+    if (x->len == 0) {
+        out[0] = '0';
+        out[1] = '\0';
+        return 1;
+    }
+    size_t total = bn_digits(x);
+    int top = top_digits(x);
+    char *p = out;
+    uint64_t v = x->limb[x->len - 1];
+    for (int i = top - 1; i >= 0; i--) {
+        if (x->radix == BN_DECIMAL) {
+            p[i] = (char)('0' + v % 10);
+            v /= 10;
+        } else {
+            p[i] = (char)('0' + (v & 1));
+            v >>= 1;
+        }
+    }
+    p += top;
+    for (size_t l = x->len - 1; l > 0; l--) {
+        v = x->limb[l - 1];
+        if (x->radix == BN_DECIMAL) {
+            format18(v, p);
+            p += DEC_DIGITS;
+        } else {
+            for (int s = 56; s >= 0; s -= 8) {
+                format8_bin((v >> s) & 0xFF, p);
+                p += 8;
+            }
+        }
+    }
+    *p = '\0';
+    return total;
+}
+
+char *bn_to_string(const bignum_t *x)
+{
+    char *s = (char *)malloc(bn_digits(x) + 1);
+    if (s == NULL) {
+        printf("Memory allocation failed.\n");
+        return NULL;
+    }
+    bn_format(x, s);
+    return s;
+}
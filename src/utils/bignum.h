@@ -0,0 +1,140 @@
+/**
+ * @file bignum.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief arbitrary precision natural numbers on 64-bit limbs, binary
+ * numbers use base 2^64 and decimal ones base 10^18 so parsing and
+ * formatting stay linear in either radix
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _BIGNUM_H_
+#define _BIGNUM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    BN_BINARY, /* limbs in base 2^64, strings of '0' and '1' */
+    BN_DECIMAL, /* limbs in base 10^18, strings of '0'..'9' */
+} bn_radix_t;
+
+/* little endian limbs, len 0 is zero, no limb above len - 1 is zero */
+typedef struct {
+    uint64_t *limb;
+    size_t len;
+    size_t cap;
+    bn_radix_t radix;
+} bignum_t;
+
+/**
+ * @brief zero in the given radix
+ *
+ * @param x
+ * @param radix
+ */
+void bn_init(bignum_t *x, bn_radix_t radix);
+
+/**
+ * @brief free the limbs
+ *
+ * @param x
+ */
+void bn_destroy(bignum_t *x);
+
+/**
+ * @brief read n digits of x's radix, most significant first, leading
+ * zeros allowed
+ *
+ * @param x
+ * @param s
+ * @param n
+ * @return int 0 on success, -1 on a digit outside the radix or
+ * allocation failure
+ */
+int bn_parse(bignum_t *x, const char *s, size_t n);
+
+/**
+ * @brief x += v, v below the limb base
+ *
+ * @param x
+ * @param v
+ * @return int 0 on success, -1 on allocation failure
+ */
+int bn_add_small(bignum_t *x, uint64_t v);
+
+/**
+ * @brief r = a + b, all in one radix, r may be a or b
+ *
+ * @param r
+ * @param a
+ * @param b
+ * @return int 0 on success, -1 on allocation failure
+ */
+int bn_add(bignum_t *r, const bignum_t *a, const bignum_t *b);
+
+/**
+ * @brief r = a - b, r may be a or b
+ *
+ * @param r
+ * @param a
+ * @param b
+ * @return int 0 on success, -1 when a < b or on allocation failure
+ */
+int bn_sub(bignum_t *r, const bignum_t *a, const bignum_t *b);
+
+/**
+ * @brief r = a * b, schoolbook, r must be neither a nor b
+ *
+ * @param r
+ * @param a
+ * @param b
+ * @return int 0 on success, -1 on allocation failure
+ */
+int bn_mul(bignum_t *r, const bignum_t *a, const bignum_t *b);
+
+/**
+ * @brief -1, 0 or 1 as a is below, equal to or above b
+ *
+ * @param a
+ * @param b
+ * @return int
+ */
+int bn_cmp(const bignum_t *a, const bignum_t *b);
+
+/**
+ * @brief digits bn_format writes, 1 for zero
+ *
+ * @param x
+ * @return size_t
+ */
+size_t bn_digits(const bignum_t *x);
+
+/**
+ * @brief write the digits of x without leading zeros and a terminator
+ *
+ * @param x
+ * @param out bn_digits(x) + 1 bytes
+ * @return size_t digits written
+ */
+size_t bn_format(const bignum_t *x, char *out);
+
+/**
+ * @brief bn_format into an exactly sized malloced string
+ *
+ * @param x
+ * @return char* NULL on allocation failure
+ */
+char *bn_to_string(const bignum_t *x);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
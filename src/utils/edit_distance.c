@@ -0,0 +1,226 @@
+/**
+ * @file edit_distance.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include "utils.h"
+#include "edit_distance.h"
+
+#define WORD_BITS 64
+
+typedef unsigned char uchar;
+
+int edit_distance_dp(const char *a, size_t n, const char *b, size_t m)
+{
+    /* row[j] holds D[i][j], diag the D[i - 1][j - 1] it overwrote */
+    int *row = (int *)malloc(sizeof(int) * (m + 1));
+
+    if (row == NULL) {
+        printf("Memory allocation failed.\n");
+        return -1;
+    }
+    for (size_t j = 0; j <= m; j++) {
+        row[j] = (int)j;
+    }
+    for (size_t i = 1; i <= n; i++) {
+        int diag = row[0];
+        row[0] = (int)i;
+        for (size_t j = 1; j <= m; j++) {
+            int up = row[j];
+            int best = diag + (a[i - 1] != b[j - 1]);
+            best = MIN(best, up + 1);
+            best = MIN(best, row[j - 1] + 1);
+            diag = up;
+            row[j] = best;
+        }
+    }
+    int dist = row[m];
+    free(row);
+    return dist;
+}
+
+int edit_distance_bounded(const char *a, size_t n, const char *b, size_t m,
+                          int max)
+{
+    /* the distance never exceeds the longer length */
+    max = (size_t)max > MAX(n, m) ? (int)MAX(n, m) : max;
+    size_t k = max;
+    int out = max + 1;
+
+    if ((n > m ? n - m : m - n) > k) {
+        return out;
+    }
+    int *row = (int *)malloc(sizeof(int) * (m + 1));
+    if (row == NULL) {
+        printf("Memory allocation failed.\n");
+        return -1;
+    }
+    /* cells outside the band stay at max + 1 */
+    for (size_t j = 0; j <= m; j++) {
+        row[j] = j <= k ? (int)j : out;
+    }
+    for (size_t i = 1; i <= n; i++) {
+        size_t lo = i > k ? i - k : 1;
+        size_t hi = MIN(m, i + k);
+        int diag = row[lo - 1];
+        row[lo - 1] = lo == 1 ? MIN((int)i, out) : out;
+        int row_min = row[lo - 1];
+        for (size_t j = lo; j <= hi; j++) {
+            int up = row[j];
+            int best = diag + (a[i - 1] != b[j - 1]);
+            best = MIN(best, up + 1);
+            best = MIN(best, row[j - 1] + 1);
+            best = MIN(best, out);
+            diag = up;
+            row[j] = best;
+            row_min = MIN(row_min, best);
+        }
+        if (row_min > max) {
+            free(row);
+            return out;
+        }
+    }
+    int dist = row[m];
+    free(row);
+    return dist;
+}
+
+/* one text byte through one 64 row block, hin is the horizontal delta
+   entering at the top, returns the one leaving at the bottom, see Myers,
+   A fast bit-vector algorithm for approximate string matching, and Hyyro
+   for the global distance form */
+static int advance_block(uint64_t *pv, uint64_t *mv, uint64_t eq, int hin,
+                         uint64_t out_bit, int *out_delta)
+{
+    uint64_t hin_neg = hin < 0;
+    uint64_t xv = eq | *mv;
+    eq |= hin_neg;
+    uint64_t xh = (((eq & *pv) + *pv) ^ *pv) | eq;
+    uint64_t ph = *mv | ~(xh | *pv);
+    uint64_t mh = *pv & xh;
+
+    *out_delta = (ph & out_bit) ? 1 : (mh & out_bit) ? -1 : 0;
+    int hout = (ph >> 63) ? 1 : (mh >> 63) ? -1 : 0;
+    ph = (ph << 1) | (hin > 0);
+    mh = (mh << 1) | hin_neg;
+    *pv = mh | ~(xv | ph);
+    *mv = ph & xv;
+    return hout;
+}
+
+/* score is D[m][j], it changes by the horizontal delta of row m */
+static int myers(const uint64_t *peq, int blocks, size_t m, uint64_t *pv,
+                 uint64_t *mv, const uchar *t, size_t n, int max)
+{
+    uint64_t last_bit = BIT64((m - 1) % WORD_BITS);
+    int64_t score = m;
+
+    for (int b = 0; b < blocks; b++) {
+        pv[b] = ~0ull;
+        mv[b] = 0;
+    }
+    for (size_t j = 0; j < n; j++) {
+        const uint64_t *eq = &peq[t[j] * blocks];
+        int h = 1; /* D[0][j] = j, the top row grows by one */
+        int delta = 0;
+        for (int b = 0; b < blocks; b++) {
+            h = advance_block(&pv[b], &mv[b], eq[b], h, last_bit, &delta);
+        }
+        score += delta;
+        /* each remaining byte lowers the score by one at most */
+        if (score - (int64_t)(n - j - 1) > max) {
+            return max + 1;
+        }
+    }
+    return score > max ? max + 1 : (int)score;
+}
+
+int edit_pattern_init(edit_pattern_t *p, const char *pat, size_t len)
+{
+    memset(p, 0, sizeof(edit_pattern_t));
+    p->len = len;
+    p->blocks = (int)((len + WORD_BITS - 1) / WORD_BITS);
+    if (len == 0) {
+        return 0;
+    }
+    p->peq = (uint64_t *)calloc(256 * p->blocks, sizeof(uint64_t));
+    p->pv = (uint64_t *)malloc(sizeof(uint64_t) * p->blocks);
+    p->mv = (uint64_t *)malloc(sizeof(uint64_t) * p->blocks);
+    if (p->peq == NULL || p->pv == NULL || p->mv == NULL) {
+        printf("Memory allocation failed.\n");
+        edit_pattern_destroy(p);
+        return -1;
+    }
+    for (size_t i = 0; i < len; i++) {
+        uchar c = pat[i];
+        p->peq[c * p->blocks + i / WORD_BITS] |= BIT64(i % WORD_BITS);
+    }
+    return 0;
+}
+
+void edit_pattern_destroy(edit_pattern_t *p)
+{
+    free(p->peq);
+    free(p->pv);
+    free(p->mv);
+    memset(p, 0, sizeof(edit_pattern_t));
+}
+
+int edit_pattern_distance(edit_pattern_t *p, const char *text, size_t len,
+                          int max)
+{
+    size_t diff = p->len > len ? p->len - len : len - p->len;
+
+    if (diff > (size_t)max) {
+        return max + 1;
+    }
+    if (p->len == 0) {
+        return (int)len;
+    }
+    return myers(p->peq, p->blocks, p->len, p->pv, p->mv,
+                 (const uchar *)text, len, max);
+}
+
+int edit_distance(const char *a, size_t n, const char *b, size_t m)
+{
+    /* the shorter string is the pattern, fewer blocks per text byte */
+    if (m > n) {
+        const char *s = a;
+        a = b;
+        b = s;
+        size_t l = n;
+        n = m;
+        m = l;
+    }
+    if (m == 0) {
+        return (int)n;
+    }
+
+    if (m <= WORD_BITS) {
+        /* one block, the table fits on the stack */
+        uint64_t peq[256] = {0};
+        uint64_t pv, mv;
+        for (size_t i = 0; i < m; i++) {
+            peq[(uchar)b[i]] |= BIT64(i);
+        }
+        return myers(peq, 1, m, &pv, &mv, (const uchar *)a, n, INT_MAX);
+    }
+
+    edit_pattern_t p;
+    if (edit_pattern_init(&p, b, m) != 0) {
+        return -1;
+    }
+    int dist = edit_pattern_distance(&p, a, n, INT_MAX);
+    edit_pattern_destroy(&p);
+    return dist;
+}
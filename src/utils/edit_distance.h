@@ -0,0 +1,102 @@
+/**
+ * @file edit_distance.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief Levenshtein distance, the rolling row DP, Myers/Hyyro bit-parallel
+ * (64 pattern bytes per word, blocked beyond) and a banded cutoff version
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _EDIT_DISTANCE_H_
+#define _EDIT_DISTANCE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* a pattern compiled once and compared against many texts */
+typedef struct {
+    size_t len;
+    int blocks; /* 64 pattern bytes each */
+    uint64_t *peq; /* [256][blocks], bit i set where pattern[i] == c */
+    uint64_t *pv; /* per block scratch, vertical +1/-1 deltas */
+    uint64_t *mv;
+} edit_pattern_t;
+
+/**
+ * @brief classic DP with one rolling row, O(n * m) time, O(m) space
+ *
+ * @param a
+ * @param n
+ * @param b
+ * @param m
+ * @return int distance, -1 on allocation failure
+ */
+int edit_distance_dp(const char *a, size_t n, const char *b, size_t m);
+
+/**
+ * @brief bit-parallel, O(n * ceil(m / 64)) for the shorter string m
+ *
+ * @param a
+ * @param n
+ * @param b
+ * @param m
+ * @return int distance, -1 on allocation failure
+ */
+int edit_distance(const char *a, size_t n, const char *b, size_t m);
+
+/**
+ * @brief DP restricted to the diagonal band |i - j| <= max, O(n * max),
+ * stops as soon as every cell of a row is above max
+ *
+ * @param a
+ * @param n
+ * @param b
+ * @param m
+ * @param max cutoff >= 0
+ * @return int distance, max + 1 when it is larger than max, -1 on
+ * allocation failure
+ */
+int edit_distance_bounded(const char *a, size_t n, const char *b, size_t m,
+                          int max);
+
+/**
+ * @brief compile a pattern for edit_pattern_distance
+ *
+ * @param p
+ * @param pat
+ * @param len
+ * @return int 0 on success, -1 on allocation failure
+ */
+int edit_pattern_init(edit_pattern_t *p, const char *pat, size_t len);
+
+/**
+ * @brief free the tables
+ *
+ * @param p
+ */
+void edit_pattern_destroy(edit_pattern_t *p);
+
+/**
+ * @brief distance from the compiled pattern to text, bit-parallel
+ *
+ * @param p
+ * @param text
+ * @param len
+ * @param max cutoff, INT_MAX for none
+ * @return int distance, max + 1 when it is larger than max
+ */
+int edit_pattern_distance(edit_pattern_t *p, const char *text, size_t len,
+                          int max);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,96 @@
+/**
+ * @file fsm.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fsm.h"
+
+int fsm_def_init(fsm_def_t *def, int num_states, int num_events)
+{
+    memset(def, 0, sizeof(fsm_def_t));
+    if (num_states <= 0 || num_states > FSM_MAX_STATES || num_events <= 0 ||
+        num_events > FSM_MAX_EVENTS) {
+        return -1;
+    }
+
+    def->table = (fsm_transition_t *)malloc(sizeof(fsm_transition_t) *
+                                            num_states * num_events);
+    if (def->table == NULL) {
+        printf("Memory allocation failed.\n");
+        return -1;
+    }
+    def->num_states = num_states;
+    def->num_events = num_events;
+    def->num_actions = 1; /* slot 0 is FSM_NO_ACTION */
+
+    for (int s = 0; s < num_states; s++) {
+        for (int e = 0; e < num_events; e++) {
+            def->table[s * num_events + e].next = (fsm_state_t)s;
+            def->table[s * num_events + e].action = FSM_NO_ACTION;
+        }
+    }
+    return 0;
+}
+
+void fsm_def_destroy(fsm_def_t *def)
+{
+    free(def->table);
+    def->table = NULL;
+}
+
+int fsm_def_action(fsm_def_t *def, fsm_action_t action)
+{
+    if (def->num_actions > FSM_MAX_ACTIONS) {
+        return -1;
+    }
+    def->actions[def->num_actions] = action;
+    return def->num_actions++;
+}
+
+int fsm_def_add(fsm_def_t *def, fsm_state_t from, fsm_event_t event,
+                fsm_state_t to, int action)
+{
+    if (from >= def->num_states || to >= def->num_states ||
+        event >= def->num_events || action < 0 ||
+        action >= def->num_actions) {
+        return -1;
+    }
+    def->table[from * def->num_events + event].next = to;
+    def->table[from * def->num_events + event].action = (uint8_t)action;
+    return 0;
+}
+
+void fsm_init(fsm_t *fsm, const fsm_def_t *def, fsm_state_t initial,
+              void *ctx)
+{
+    fsm->def = def;
+    fsm->state = initial;
+    fsm->ctx = ctx;
+}
+
+void fsm_dispatch_batch(const fsm_def_t *def, fsm_state_t *states,
+                        const fsm_event_t *events, void **ctx, size_t n)
+{
+    const fsm_transition_t *table = def->table;
+    int num_events = def->num_events;
+
+    /* states and events are streamed, the table stays hot in L1 */
+    for (size_t i = 0; i < n; i++) {
+        fsm_state_t from = states[i];
+        fsm_transition_t t = table[from * num_events + events[i]];
+        states[i] = t.next;
+        if (t.action != FSM_NO_ACTION) {
+            def->actions[t.action](ctx ? ctx[i] : NULL, from, events[i],
+                                   t.next);
+        }
+    }
+}
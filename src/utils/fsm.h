@@ -0,0 +1,148 @@
+/**
+ * @file fsm.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief table driven finite state machine, transitions live in a dense
+ * [state][event] array so dispatching an event is one indexed load
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _FSM_H_
+#define _FSM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FSM_MAX_STATES 255
+#define FSM_MAX_EVENTS 255
+#define FSM_MAX_ACTIONS 255
+#define FSM_NO_ACTION 0
+
+typedef uint8_t fsm_state_t;
+typedef uint8_t fsm_event_t;
+
+/* called after the state changed, ctx is the machine's user data */
+typedef void (*fsm_action_t)(void *ctx, fsm_state_t from, fsm_event_t event,
+                             fsm_state_t to);
+
+/* two bytes per cell, a 16x16 machine fits in eight cache lines */
+typedef struct {
+    fsm_state_t next;
+    uint8_t action; /* index into actions[], FSM_NO_ACTION for none */
+} fsm_transition_t;
+
+/*
+            event0      event1      ...
+    state0  {next, act} {next, act}
+    state1  {next, act} {next, act}
+    ...
+*/
+typedef struct {
+    int num_states;
+    int num_events;
+    fsm_transition_t *table; /* num_states * num_events cells */
+    fsm_action_t actions[FSM_MAX_ACTIONS + 1];
+    int num_actions;
+} fsm_def_t;
+
+/* one running instance, the definition is shared by all instances */
+typedef struct {
+    const fsm_def_t *def;
+    fsm_state_t state;
+    void *ctx;
+} fsm_t;
+
+/**
+ * @brief allocate a table where every event keeps the current state
+ *
+ * @param def
+ * @param num_states
+ * @param num_events
+ * @return int 0 on success, -1 on bad size or allocation failure
+ */
+int fsm_def_init(fsm_def_t *def, int num_states, int num_events);
+
+/**
+ * @brief free the table
+ *
+ * @param def
+ */
+void fsm_def_destroy(fsm_def_t *def);
+
+/**
+ * @brief register an action callback
+ *
+ * @param def
+ * @param action
+ * @return int action index for fsm_def_add, -1 if the table is full
+ */
+int fsm_def_action(fsm_def_t *def, fsm_action_t action);
+
+/**
+ * @brief set the cell for (from, event)
+ *
+ * @param def
+ * @param from
+ * @param event
+ * @param to
+ * @param action index from fsm_def_action or FSM_NO_ACTION
+ * @return int 0 on success, -1 on out of range arguments
+ */
+int fsm_def_add(fsm_def_t *def, fsm_state_t from, fsm_event_t event,
+                fsm_state_t to, int action);
+
+/**
+ * @brief bind an instance to a definition
+ *
+ * @param fsm
+ * @param def
+ * @param initial
+ * @param ctx
+ */
+void fsm_init(fsm_t *fsm, const fsm_def_t *def, fsm_state_t initial,
+              void *ctx);
+
+/**
+ * @brief feed one event, no range check on event for speed
+ *
+ * @param fsm
+ * @param event
+ * @return fsm_state_t the new state
+ */
+static inline fsm_state_t fsm_dispatch(fsm_t *fsm, fsm_event_t event)
+{
+    const fsm_def_t *def = fsm->def;
+    fsm_state_t from = fsm->state;
+    fsm_transition_t t = def->table[from * def->num_events + event];
+
+    fsm->state = t.next;
+    if (t.action != FSM_NO_ACTION) {
+        def->actions[t.action](fsm->ctx, from, event, t.next);
+    }
+    return t.next;
+}
+
+/**
+ * @brief data oriented dispatch, states[i] of machine i consumes events[i],
+ * all machines share def and actions get ctx[i] (ctx may be NULL)
+ *
+ * @param def
+ * @param states
+ * @param events
+ * @param ctx
+ * @param n
+ */
+void fsm_dispatch_batch(const fsm_def_t *def, fsm_state_t *states,
+                        const fsm_event_t *events, void **ctx, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
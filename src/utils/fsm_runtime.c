@@ -0,0 +1,503 @@
+/**
+ * @file fsm_runtime.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+
+#include "fsm_runtime.h"
+
+#define RT_DEQUE_SIZE (1 << 16) /* per worker, overflow goes global */
+#define RT_BATCH 64 /* events per actor activation, keeps actors fair */
+#define RT_GLOBAL_GRAB 32 /* actors moved from the global queue at once */
+#define RT_SPINS 64 /* steal rounds before a worker parks */
+#define RT_MSG_CACHE 4096 /* free messages kept per thread */
+
+#define LOAD(p, mo) __atomic_load_n((p), (mo))
+#define STORE(p, v, mo) __atomic_store_n((p), (v), (mo))
+
+/* Chase-Lev work stealing deque, the owner pushes and takes at bottom,
+   thieves steal at top. Indices wrap, only their difference matters */
+typedef struct {
+    unsigned long top;
+    char pad0[64];
+    unsigned long bottom;
+    char pad1[64];
+    fsm_actor_t **buf;
+} rt_deque_t;
+
+typedef struct {
+    fsm_runtime_t *rt;
+    int id;
+    pthread_t thread;
+    rt_deque_t dq;
+    unsigned int seed;
+    /* owned counters, summed by fsm_runtime_wait_idle */
+    unsigned long sent;
+    unsigned long handled;
+    char pad[64];
+} rt_worker_t;
+
+struct fsm_runtime {
+    int num_workers;
+    int num_started; /* workers whose thread is running */
+    int stop;
+    int sleeping;
+    unsigned long sent_external; /* sends from non-worker threads */
+    /* global run queue for external sends and deque overflow */
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    fsm_actor_t *global_head;
+    fsm_actor_t *global_tail;
+    rt_worker_t workers[FSM_RT_MAX_WORKERS];
+};
+
+static __thread rt_worker_t *tls_worker;
+static __thread fsm_msg_t *tls_msg_cache;
+static __thread int tls_msg_cached;
+
+static bool deque_push(rt_deque_t *dq, fsm_actor_t *actor)
+{
+    unsigned long b = LOAD(&dq->bottom, __ATOMIC_RELAXED);
+    unsigned long t = LOAD(&dq->top, __ATOMIC_ACQUIRE);
+
+    if ((long)(b - t) >= RT_DEQUE_SIZE) {
+        return false;
+    }
+    STORE(&dq->buf[b & (RT_DEQUE_SIZE - 1)], actor, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    STORE(&dq->bottom, b + 1, __ATOMIC_RELAXED);
+    return true;
+}
+
+static fsm_actor_t *deque_take(rt_deque_t *dq)
+{
+    unsigned long b = LOAD(&dq->bottom, __ATOMIC_RELAXED) - 1;
+    STORE(&dq->bottom, b, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    unsigned long t = LOAD(&dq->top, __ATOMIC_RELAXED);
+    fsm_actor_t *actor = NULL;
+
+    if ((long)(b - t) >= 0) {
+        actor = LOAD(&dq->buf[b & (RT_DEQUE_SIZE - 1)], __ATOMIC_RELAXED);
+        if (b == t) {
+            /* last item, race the thieves for it */
+            if (!__atomic_compare_exchange_n(&dq->top, &t, t + 1, false,
+                                             __ATOMIC_SEQ_CST,
+                                             __ATOMIC_RELAXED)) {
+                actor = NULL;
+            }
+            STORE(&dq->bottom, b + 1, __ATOMIC_RELAXED);
+        }
+    } else {
+        STORE(&dq->bottom, b + 1, __ATOMIC_RELAXED);
+    }
+    return actor;
+}
+
+static fsm_actor_t *deque_steal(rt_deque_t *dq)
+{
+    unsigned long t = LOAD(&dq->top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    unsigned long b = LOAD(&dq->bottom, __ATOMIC_ACQUIRE);
+
+    if ((long)(b - t) <= 0) {
+        return NULL;
+    }
+    fsm_actor_t *actor =
+        LOAD(&dq->buf[t & (RT_DEQUE_SIZE - 1)], __ATOMIC_RELAXED);
+    if (!__atomic_compare_exchange_n(&dq->top, &t, t + 1, false,
+                                     __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+        return NULL;
+    }
+    return actor;
+}
+
+/* Vyukov intrusive MPSC queue */
+static void mailbox_init(fsm_mailbox_t *mb)
+{
+    mb->stub.next = NULL;
+    mb->head = &mb->stub;
+    mb->tail = &mb->stub;
+}
+
+static void mailbox_push(fsm_mailbox_t *mb, fsm_msg_t *msg)
+{
+    STORE(&msg->next, (fsm_msg_t *)NULL, __ATOMIC_RELAXED);
+    fsm_msg_t *prev = __atomic_exchange_n(&mb->head, msg, __ATOMIC_SEQ_CST);
+    STORE(&prev->next, msg, __ATOMIC_RELEASE);
+}
+
+/* NULL when empty or when a producer is between its two steps */
+static fsm_msg_t *mailbox_pop(fsm_mailbox_t *mb)
+{
+    fsm_msg_t *tail = mb->tail;
+    fsm_msg_t *next = LOAD(&tail->next, __ATOMIC_ACQUIRE);
+
+    if (tail == &mb->stub) {
+        if (next == NULL) {
+            return NULL;
+        }
+        mb->tail = next;
+        tail = next;
+        next = LOAD(&tail->next, __ATOMIC_ACQUIRE);
+    }
+    if (next != NULL) {
+        mb->tail = next;
+        return tail;
+    }
+    if (tail != LOAD(&mb->head, __ATOMIC_ACQUIRE)) {
+        return NULL;
+    }
+    mailbox_push(mb, &mb->stub);
+    next = LOAD(&tail->next, __ATOMIC_ACQUIRE);
+    if (next != NULL) {
+        mb->tail = next;
+        return tail;
+    }
+    return NULL;
+}
+
+/* tail is read by the consumer before it lets go of the actor, after
+   that another worker may pop and free it, so it is only compared */
+static bool mailbox_empty(fsm_mailbox_t *mb, fsm_msg_t *tail)
+{
+    return tail == &mb->stub && LOAD(&mb->head, __ATOMIC_SEQ_CST) == tail;
+}
+
+static fsm_msg_t *msg_alloc(void)
+{
+    fsm_msg_t *msg = tls_msg_cache;
+
+    if (msg != NULL) {
+        tls_msg_cache = msg->next;
+        tls_msg_cached--;
+        return msg;
+    }
+    return (fsm_msg_t *)malloc(sizeof(fsm_msg_t));
+}
+
+static void msg_free(fsm_msg_t *msg)
+{
+    if (tls_msg_cached >= RT_MSG_CACHE) {
+        free(msg);
+        return;
+    }
+    msg->next = tls_msg_cache;
+    tls_msg_cache = msg;
+    tls_msg_cached++;
+}
+
+static void msg_cache_drain(void)
+{
+    while (tls_msg_cache != NULL) {
+        fsm_msg_t *msg = tls_msg_cache;
+        tls_msg_cache = msg->next;
+        free(msg);
+    }
+    tls_msg_cached = 0;
+}
+
+static void global_push(fsm_runtime_t *rt, fsm_actor_t *actor)
+{
+    pthread_mutex_lock(&rt->lock);
+    actor->run_next = NULL;
+    if (rt->global_tail == NULL) {
+        STORE(&rt->global_head, actor, __ATOMIC_RELAXED);
+    } else {
+        rt->global_tail->run_next = actor;
+    }
+    rt->global_tail = actor;
+    if (rt->sleeping > 0) {
+        pthread_cond_signal(&rt->cond);
+    }
+    pthread_mutex_unlock(&rt->lock);
+}
+
+/* move a batch to the local deque and return one to run now */
+static fsm_actor_t *global_take(fsm_runtime_t *rt, rt_worker_t *w)
+{
+    fsm_actor_t *first = NULL;
+
+    if (LOAD(&rt->global_head, __ATOMIC_RELAXED) == NULL) {
+        return NULL;
+    }
+    pthread_mutex_lock(&rt->lock);
+    for (int i = 0; i < RT_GLOBAL_GRAB && rt->global_head != NULL; i++) {
+        fsm_actor_t *actor = rt->global_head;
+        if (first != NULL && !deque_push(&w->dq, actor)) {
+            break;
+        }
+        STORE(&rt->global_head, actor->run_next, __ATOMIC_RELAXED);
+        if (rt->global_head == NULL) {
+            rt->global_tail = NULL;
+        }
+        if (first == NULL) {
+            first = actor;
+        }
+    }
+    pthread_mutex_unlock(&rt->lock);
+    return first;
+}
+
+static void schedule(fsm_runtime_t *rt, fsm_actor_t *actor)
+{
+    rt_worker_t *w = tls_worker;
+
+    if (w != NULL && w->rt == rt && deque_push(&w->dq, actor)) {
+        /* a parked worker could steal it */
+        if (LOAD(&rt->sleeping, __ATOMIC_RELAXED) > 0) {
+            pthread_mutex_lock(&rt->lock);
+            pthread_cond_signal(&rt->cond);
+            pthread_mutex_unlock(&rt->lock);
+        }
+        return;
+    }
+    global_push(rt, actor);
+}
+
+static void run_actor(rt_worker_t *w, fsm_actor_t *actor)
+{
+    fsm_msg_t *msg;
+    int n = 0;
+
+    while (n < RT_BATCH && (msg = mailbox_pop(&actor->mailbox)) != NULL) {
+        fsm_event_t event = msg->event;
+        msg_free(msg);
+        fsm_dispatch(&actor->fsm, event);
+        n++;
+    }
+    STORE(&w->handled, w->handled + n, __ATOMIC_RELEASE);
+    fsm_msg_t *tail = actor->mailbox.tail;
+
+    /* pairs with the exchange in fsm_actor_send, either the sender sees
+       0 and schedules, or we see its message and reschedule */
+    STORE(&actor->scheduled, 0, __ATOMIC_SEQ_CST);
+    if (!mailbox_empty(&actor->mailbox, tail)) {
+        int expected = 0;
+        if (__atomic_compare_exchange_n(&actor->scheduled, &expected, 1,
+                                        false, __ATOMIC_SEQ_CST,
+                                        __ATOMIC_RELAXED)) {
+            schedule(w->rt, actor);
+        }
+    }
+}
+
+static fsm_actor_t *steal_any(fsm_runtime_t *rt, rt_worker_t *w)
+{
+    int n = rt->num_workers;
+    int start = rand_r(&w->seed) % n;
+
+    for (int i = 0; i < n; i++) {
+        rt_worker_t *victim = &rt->workers[(start + i) % n];
+        if (victim == w) {
+            continue;
+        }
+        fsm_actor_t *actor = deque_steal(&victim->dq);
+        if (actor != NULL) {
+            return actor;
+        }
+    }
+    return NULL;
+}
+
+static void *worker_main(void *arg)
+{
+    rt_worker_t *w = (rt_worker_t *)arg;
+    fsm_runtime_t *rt = w->rt;
+    int idle = 0;
+
+    tls_worker = w;
+    while (!LOAD(&rt->stop, __ATOMIC_ACQUIRE)) {
+        fsm_actor_t *actor = deque_take(&w->dq);
+        if (actor == NULL) {
+            actor = global_take(rt, w);
+        }
+        if (actor == NULL) {
+            actor = steal_any(rt, w);
+        }
+        if (actor != NULL) {
+            run_actor(w, actor);
+            idle = 0;
+            continue;
+        }
+        if (++idle < RT_SPINS) {
+            sched_yield();
+            continue;
+        }
+
+        /* park, the timeout covers a signal sent before we got here */
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        ts.tv_nsec += 1000000;
+        if (ts.tv_nsec >= 1000000000) {
+            ts.tv_sec++;
+            ts.tv_nsec -= 1000000000;
+        }
+        pthread_mutex_lock(&rt->lock);
+        if (rt->global_head == NULL && !rt->stop) {
+            rt->sleeping++;
+            pthread_cond_timedwait(&rt->cond, &rt->lock, &ts);
+            rt->sleeping--;
+        }
+        pthread_mutex_unlock(&rt->lock);
+        idle = 0;
+    }
+    msg_cache_drain();
+    tls_worker = NULL;
+    return NULL;
+}
+
+fsm_runtime_t *fsm_runtime_create(int workers)
+{
+    if (workers <= 0 || workers > FSM_RT_MAX_WORKERS) {
+        return NULL;
+    }
+    fsm_runtime_t *rt = (fsm_runtime_t *)calloc(1, sizeof(fsm_runtime_t));
+    if (rt == NULL) {
+        printf("Memory allocation failed.\n");
+        return NULL;
+    }
+    rt->num_workers = workers;
+    pthread_mutex_init(&rt->lock, NULL);
+    pthread_cond_init(&rt->cond, NULL);
+
+    for (int i = 0; i < workers; i++) {
+        rt_worker_t *w = &rt->workers[i];
+        w->rt = rt;
+        w->id = i;
+        w->seed = i + 1;
+        w->dq.buf = (fsm_actor_t **)calloc(RT_DEQUE_SIZE, sizeof(void *));
+        if (w->dq.buf == NULL) {
+            printf("Memory allocation failed.\n");
+            rt->num_workers = i;
+            fsm_runtime_destroy(rt);
+            return NULL;
+        }
+    }
+    for (int i = 0; i < workers; i++) {
+        if (pthread_create(&rt->workers[i].thread, NULL, worker_main,
+                           &rt->workers[i]) != 0) {
+            /* stop the ones already running, nothing was sent yet */
+            fsm_runtime_destroy(rt);
+            return NULL;
+        }
+        rt->num_started = i + 1;
+    }
+    return rt;
+}
+
+/* free the events of an actor that will not run again */
+static void drop_queued(fsm_actor_t *actor)
+{
+    fsm_msg_t *msg;
+
+    while ((msg = mailbox_pop(&actor->mailbox)) != NULL) {
+        free(msg);
+    }
+    actor->scheduled = 0;
+}
+
+void fsm_runtime_destroy(fsm_runtime_t *rt)
+{
+    if (rt == NULL) {
+        return;
+    }
+    pthread_mutex_lock(&rt->lock);
+    STORE(&rt->stop, 1, __ATOMIC_RELEASE);
+    pthread_cond_broadcast(&rt->cond);
+    pthread_mutex_unlock(&rt->lock);
+
+    for (int i = 0; i < rt->num_started; i++) {
+        pthread_join(rt->workers[i].thread, NULL);
+    }
+
+    /* every actor with events left is in a run queue, nothing runs now */
+    for (int i = 0; i < rt->num_workers; i++) {
+        rt_deque_t *dq = &rt->workers[i].dq;
+        for (unsigned long k = dq->top; dq->buf != NULL && k != dq->bottom;
+             k++) {
+            drop_queued(dq->buf[k & (RT_DEQUE_SIZE - 1)]);
+        }
+        free(dq->buf);
+    }
+    for (fsm_actor_t *a = rt->global_head; a != NULL; a = a->run_next) {
+        drop_queued(a);
+    }
+    pthread_mutex_destroy(&rt->lock);
+    pthread_cond_destroy(&rt->cond);
+    msg_cache_drain();
+    free(rt);
+}
+
+void fsm_runtime_wait_idle(fsm_runtime_t *rt)
+{
+    for (;;) {
+        /* handled first: anything handled was sent earlier, so equal sums
+           mean nothing sent before the second read is still queued */
+        unsigned long handled = 0, sent = 0;
+        for (int i = 0; i < rt->num_workers; i++) {
+            handled += LOAD(&rt->workers[i].handled, __ATOMIC_ACQUIRE);
+        }
+        for (int i = 0; i < rt->num_workers; i++) {
+            sent += LOAD(&rt->workers[i].sent, __ATOMIC_ACQUIRE);
+        }
+        sent += LOAD(&rt->sent_external, __ATOMIC_ACQUIRE);
+        if (handled == sent) {
+            return;
+        }
+        struct timespec ts = {0, 100000};
+        nanosleep(&ts, NULL);
+    }
+}
+
+void fsm_actor_init(fsm_actor_t *actor, fsm_runtime_t *rt,
+                    const fsm_def_t *def, fsm_state_t initial, void *ctx)
+{
+    fsm_init(&actor->fsm, def, initial, ctx);
+    mailbox_init(&actor->mailbox);
+    actor->rt = rt;
+    actor->run_next = NULL;
+    actor->scheduled = 0;
+}
+
+int fsm_actor_send(fsm_actor_t *actor, fsm_event_t event)
+{
+    fsm_runtime_t *rt = actor->rt;
+    rt_worker_t *w = tls_worker;
+    fsm_msg_t *msg = msg_alloc();
+
+    if (msg == NULL) {
+        printf("Memory allocation failed.\n");
+        return -1;
+    }
+    msg->event = event;
+
+    /* count before the event becomes visible so wait_idle never sees it
+       handled but not sent */
+    if (w != NULL && w->rt == rt) {
+        STORE(&w->sent, w->sent + 1, __ATOMIC_RELEASE);
+    } else {
+        __atomic_fetch_add(&rt->sent_external, 1, __ATOMIC_RELEASE);
+    }
+    mailbox_push(&actor->mailbox, msg);
+    if (__atomic_exchange_n(&actor->scheduled, 1, __ATOMIC_SEQ_CST) == 0) {
+        schedule(rt, actor);
+    }
+    return 0;
+}
+
+fsm_state_t fsm_actor_state(const fsm_actor_t *actor)
+{
+    return LOAD(&actor->fsm.state, __ATOMIC_ACQUIRE);
+}
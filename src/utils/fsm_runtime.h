@@ -0,0 +1,110 @@
+/**
+ * @file fsm_runtime.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief actor style runtime for fsm.h machines, every machine owns a
+ * lock-free mailbox and runs on a fixed pool of work stealing workers
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _FSM_RUNTIME_H_
+#define _FSM_RUNTIME_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "fsm.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FSM_RT_MAX_WORKERS 64
+
+typedef struct fsm_msg {
+    struct fsm_msg *next;
+    fsm_event_t event;
+} fsm_msg_t;
+
+/* multi producer single consumer queue, the consumer is whichever worker
+   currently runs the actor, at most one at a time */
+typedef struct {
+    fsm_msg_t *head; /* producers swap in here */
+    fsm_msg_t *tail; /* consumer pops here */
+    fsm_msg_t stub;
+} fsm_mailbox_t;
+
+struct fsm_runtime;
+
+typedef struct fsm_actor {
+    fsm_t fsm;
+    fsm_mailbox_t mailbox;
+    struct fsm_runtime *rt;
+    struct fsm_actor *run_next; /* global run queue link */
+    int scheduled; /* 1 while queued or running */
+} fsm_actor_t;
+
+typedef struct fsm_runtime fsm_runtime_t;
+
+/**
+ * @brief start a pool of worker threads
+ *
+ * @param workers 1..FSM_RT_MAX_WORKERS
+ * @return fsm_runtime_t* NULL on error
+ */
+fsm_runtime_t *fsm_runtime_create(int workers);
+
+/**
+ * @brief stop and join the workers, call fsm_runtime_wait_idle first if
+ * queued events must be handled, undelivered events are dropped, so
+ * actors that still have some must outlive this call
+ *
+ * @param rt
+ */
+void fsm_runtime_destroy(fsm_runtime_t *rt);
+
+/**
+ * @brief block until every event sent so far, and every event sent by
+ * the actions it triggered, has been dispatched
+ *
+ * @param rt
+ */
+void fsm_runtime_wait_idle(fsm_runtime_t *rt);
+
+/**
+ * @brief bind an actor to a runtime, actions receive ctx
+ *
+ * @param actor
+ * @param rt
+ * @param def shared transition table
+ * @param initial
+ * @param ctx
+ */
+void fsm_actor_init(fsm_actor_t *actor, fsm_runtime_t *rt,
+                    const fsm_def_t *def, fsm_state_t initial, void *ctx);
+
+/**
+ * @brief queue an event, callable from any thread including actions, the
+ * actor handles its events one at a time in send order per sender
+ *
+ * @param actor
+ * @param event
+ * @return int 0 on success, -1 on allocation failure
+ */
+int fsm_actor_send(fsm_actor_t *actor, fsm_event_t event);
+
+/**
+ * @brief current state, exact only while the actor is idle
+ *
+ * @param actor
+ * @return fsm_state_t
+ */
+fsm_state_t fsm_actor_state(const fsm_actor_t *actor);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
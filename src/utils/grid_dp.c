@@ -0,0 +1,253 @@
+/**
+ * @file grid_dp.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "utils.h"
+#include "grid_dp.h"
+
+#define GRID_DP_INF (INT64_MAX / 2)
+
+typedef enum {
+    GRID_OP_MIN_SUM,
+    GRID_OP_COUNT,
+} grid_op_t;
+
+typedef struct {
+    grid_op_t op;
+    int **grid;
+    int rows;
+    int cols;
+    /* row[j] is the last value computed in column j, col[i] the last one
+       in row i, tiles of one wave touch disjoint parts of both */
+    int64_t *row;
+    int64_t *col;
+    int tile_rows;
+    int tile_cols;
+    int threads;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int arrived;
+    unsigned gen;
+} sweep_t;
+
+typedef struct {
+    sweep_t *sw;
+    int id;
+} worker_t;
+
+static void sweep_tile(const sweep_t *sw, int ti, int tj)
+{
+    int r0 = ti * GRID_DP_TILE, r1 = MIN(r0 + GRID_DP_TILE, sw->rows);
+    int c0 = tj * GRID_DP_TILE, c1 = MIN(c0 + GRID_DP_TILE, sw->cols);
+    int64_t *row = sw->row;
+
+    /* the left neighbour runs in a register along the row */
+    for (int i = r0; i < r1; i++) {
+        const int *g = sw->grid[i];
+        int64_t left = sw->col[i];
+        if (sw->op == GRID_OP_MIN_SUM) {
+            for (int j = c0; j < c1; j++) {
+                left = MIN(row[j], left) + g[j];
+                row[j] = left;
+            }
+        } else {
+            for (int j = c0; j < c1; j++) {
+                uint64_t paths = (uint64_t)row[j] + (uint64_t)left;
+                left = g[j] ? 0 : (int64_t)paths;
+                row[j] = left;
+            }
+        }
+        sw->col[i] = left;
+    }
+}
+
+static void sweep_wait(sweep_t *sw)
+{
+    pthread_mutex_lock(&sw->lock);
+    unsigned gen = sw->gen;
+    if (++sw->arrived == sw->threads) {
+        sw->arrived = 0;
+        sw->gen++;
+        pthread_cond_broadcast(&sw->cond);
+    } else {
+        while (gen == sw->gen) {
+            pthread_cond_wait(&sw->cond, &sw->lock);
+        }
+    }
+    pthread_mutex_unlock(&sw->lock);
+}
+
+/* tile (ti, tj) needs (ti - 1, tj) and (ti, tj - 1), so all tiles with
+   ti + tj = d are independent once wave d - 1 is done */
+static void sweep_waves(sweep_t *sw, int id)
+{
+    for (int d = 0; d < sw->tile_rows + sw->tile_cols - 1; d++) {
+        int lo = MAX(0, d - (sw->tile_cols - 1));
+        int hi = MIN(d, sw->tile_rows - 1);
+        for (int ti = lo + id; ti <= hi; ti += sw->threads) {
+            sweep_tile(sw, ti, d - ti);
+        }
+        if (sw->threads > 1) {
+            sweep_wait(sw);
+        }
+    }
+}
+
+static void *sweep_worker(void *arg)
+{
+    worker_t *w = (worker_t *)arg;
+
+    /* held by the creator until the thread count is final */
+    pthread_mutex_lock(&w->sw->lock);
+    pthread_mutex_unlock(&w->sw->lock);
+    sweep_waves(w->sw, w->id);
+    return NULL;
+}
+
+static int pick_threads(const sweep_t *sw, int threads)
+{
+    if ((int64_t)sw->rows * sw->cols < GRID_DP_PARALLEL_CELLS) {
+        return 1;
+    }
+    if (threads <= 0) {
+        long n = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = n > 0 ? (int)n : 1;
+    }
+    /* no wave is wider than this */
+    threads = MIN(threads, MIN(sw->tile_rows, sw->tile_cols));
+    return MIN(threads, GRID_DP_MAX_THREADS);
+}
+
+static void sweep_parallel(sweep_t *sw, int threads)
+{
+    pthread_t tids[GRID_DP_MAX_THREADS];
+    worker_t workers[GRID_DP_MAX_THREADS];
+    int started = 0;
+
+    pthread_mutex_init(&sw->lock, NULL);
+    pthread_cond_init(&sw->cond, NULL);
+    sw->arrived = 0;
+    sw->gen = 0;
+
+    /* a thread that fails to start only narrows the sweep */
+    pthread_mutex_lock(&sw->lock);
+    for (int t = 1; t < threads; t++) {
+        workers[started].sw = sw;
+        workers[started].id = started + 1;
+        if (pthread_create(&tids[started], NULL, sweep_worker,
+                           &workers[started]) == 0) {
+            started++;
+        }
+    }
+    sw->threads = started + 1;
+    pthread_mutex_unlock(&sw->lock);
+
+    sweep_waves(sw, 0);
+    for (int t = 0; t < started; t++) {
+        pthread_join(tids[t], NULL);
+    }
+    pthread_cond_destroy(&sw->cond);
+    pthread_mutex_destroy(&sw->lock);
+}
+
+static int sweep(grid_op_t op, int **grid, int rows, int cols, int threads,
+                 int64_t *out)
+{
+    if (rows <= 0 || cols <= 0) {
+        return -1;
+    }
+    sweep_t sw;
+    sw.op = op;
+    sw.grid = grid;
+    sw.rows = rows;
+    sw.cols = cols;
+    sw.tile_rows = (rows + GRID_DP_TILE - 1) / GRID_DP_TILE;
+    sw.tile_cols = (cols + GRID_DP_TILE - 1) / GRID_DP_TILE;
+    sw.row = (int64_t *)malloc(sizeof(int64_t) * (rows + cols));
+    if (sw.row == NULL) {
+        printf("Memory allocation failed.\n");
+        return -1;
+    }
+    sw.col = sw.row + cols;
+
+    /* a virtual cell above the start feeds it 0 or one path, everything
+       else outside the grid is unreachable */
+    int64_t none = op == GRID_OP_MIN_SUM ? GRID_DP_INF : 0;
+    for (int j = 0; j < cols; j++) {
+        sw.row[j] = none;
+    }
+    for (int i = 0; i < rows; i++) {
+        sw.col[i] = none;
+    }
+    sw.row[0] = op == GRID_OP_MIN_SUM ? 0 : 1;
+
+    threads = pick_threads(&sw, threads);
+    if (threads > 1) {
+        sweep_parallel(&sw, threads);
+    } else {
+        sw.threads = 1;
+        sweep_waves(&sw, 0);
+    }
+    *out = sw.row[cols - 1];
+    free(sw.row);
+    return 0;
+}
+
+int grid_dp_min_path_sum(int **grid, int rows, int cols, int threads,
+                         int64_t *sum)
+{
+    return sweep(GRID_OP_MIN_SUM, grid, rows, cols, threads, sum);
+}
+
+int grid_dp_count_paths(int **obstacles, int rows, int cols, int threads,
+                        uint64_t *count)
+{
+    int64_t n;
+
+    if (sweep(GRID_OP_COUNT, obstacles, rows, cols, threads, &n) != 0) {
+        return -1;
+    }
+    *count = (uint64_t)n;
+    return 0;
+}
+
+static uint64_t gcd(uint64_t a, uint64_t b)
+{
+    while (b != 0) {
+        uint64_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+uint64_t grid_dp_unique_paths(int m, int n)
+{
+    if (m <= 0 || n <= 0) {
+        return 0;
+    }
+    /* C(m + n - 2, k) for the smaller k, c * f / i is the next binomial
+       so it is whole, and with g = gcd(c, i) the rest of i divides f,
+       which keeps the products within 64 bits */
+    uint64_t total = (uint64_t)m + n - 2;
+    uint64_t k = (uint64_t)MIN(m, n) - 1;
+    uint64_t c = 1;
+    for (uint64_t i = 1; i <= k; i++) {
+        uint64_t f = total - k + i;
+        uint64_t g = gcd(c, i);
+        c = c / g * (f / (i / g));
+    }
+    return c;
+}
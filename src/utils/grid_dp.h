@@ -0,0 +1,71 @@
+/**
+ * @file grid_dp.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief right/down path DP over a grid in O(rows + cols) memory, one
+ * rolling row plus the column on the tile boundaries, big grids swept in
+ * anti-diagonal waves of tiles shared between threads
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _GRID_DP_H_
+#define _GRID_DP_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* tile edge, a tile row of int64_t and of int stays in L1 */
+#define GRID_DP_TILE 256
+
+/* grids smaller than this are swept by the calling thread alone */
+#define GRID_DP_PARALLEL_CELLS (1 << 20)
+
+#define GRID_DP_MAX_THREADS 64
+
+/**
+ * @brief smallest sum of a path from the top left to the bottom right
+ * cell moving right or down
+ *
+ * @param grid rows row pointers of cols values
+ * @param rows
+ * @param cols
+ * @param threads 0 for one per online CPU, at most GRID_DP_MAX_THREADS
+ * @param sum
+ * @return int 0 on success, -1 on an empty grid or allocation failure
+ */
+int grid_dp_min_path_sum(int **grid, int rows, int cols, int threads,
+                         int64_t *sum);
+
+/**
+ * @brief number of right/down paths avoiding the nonzero cells, modulo 2^64
+ *
+ * @param obstacles rows row pointers of cols values, nonzero is blocked
+ * @param rows
+ * @param cols
+ * @param threads 0 for one per online CPU, at most GRID_DP_MAX_THREADS
+ * @param count
+ * @return int 0 on success, -1 on an empty grid or allocation failure
+ */
+int grid_dp_count_paths(int **obstacles, int rows, int cols, int threads,
+                        uint64_t *count);
+
+/**
+ * @brief paths through an open m x n grid, C(m + n - 2, m - 1) in
+ * O(min(m, n)), exact while the result fits in 64 bits
+ *
+ * @param m
+ * @param n
+ * @return uint64_t 0 if m or n is not positive
+ */
+uint64_t grid_dp_unique_paths(int m, int n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,151 @@
+/**
+ * @file histogram.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <string.h>
+
+#include "histogram.h"
+
+/* below this a single table is cheaper than clearing and folding four */
+#define HIST_SHORT 64
+
+void hist_count(const char *s, size_t len, uint32_t *h)
+{
+    const unsigned char *p = (const unsigned char *)s;
+    size_t i = 0;
+
+    memset(h, 0, sizeof(uint32_t) * HIST_SIZE);
+    if (len < HIST_SHORT) {
+        for (; i < len; i++) {
+            h[p[i]]++;
+        }
+        return;
+    }
+
+    /* a byte repeated back to back would make each increment wait for
+       the store of the previous one, four tables keep neighbours apart */
+    uint32_t t[4][HIST_SIZE];
+    memset(t, 0, sizeof(t));
+    for (; i + 8 <= len; i += 8) {
+        uint64_t w;
+        memcpy(&w, p + i, 8);
+        t[0][w & 0xFF]++;
+        t[1][(w >> 8) & 0xFF]++;
+        t[2][(w >> 16) & 0xFF]++;
+        t[3][(w >> 24) & 0xFF]++;
+        t[0][(w >> 32) & 0xFF]++;
+        t[1][(w >> 40) & 0xFF]++;
+        t[2][(w >> 48) & 0xFF]++;
+        t[3][w >> 56]++;
+    }
+    for (; i < len; i++) {
+        t[0][p[i]]++;
+    }
+    for (int c = 0; c < HIST_SIZE; c++) {
+        h[c] = t[0][c] + t[1][c] + t[2][c] + t[3][c];
+    }
+}
+
+void hist_count_diff(const char *a, const char *b, size_t len, int32_t *d)
+{
+    const unsigned char *p = (const unsigned char *)a;
+    const unsigned char *q = (const unsigned char *)b;
+    size_t i = 0;
+
+    memset(d, 0, sizeof(int32_t) * HIST_SIZE);
+    if (len < HIST_SHORT) {
+        for (; i < len; i++) {
+            d[p[i]]++;
+            d[q[i]]--;
+        }
+        return;
+    }
+
+    /* a[i] and b[i] are often the same byte, so they go to different
+       tables as well */
+    int32_t t[4][HIST_SIZE];
+    memset(t, 0, sizeof(t));
+    for (; i + 4 <= len; i += 4) {
+        uint32_t x, y;
+        memcpy(&x, p + i, 4);
+        memcpy(&y, q + i, 4);
+        t[0][x & 0xFF]++;
+        t[1][y & 0xFF]--;
+        t[2][(x >> 8) & 0xFF]++;
+        t[3][(y >> 8) & 0xFF]--;
+        t[0][(x >> 16) & 0xFF]++;
+        t[1][(y >> 16) & 0xFF]--;
+        t[2][x >> 24]++;
+        t[3][y >> 24]--;
+    }
+    for (; i < len; i++) {
+        t[0][p[i]]++;
+        t[1][q[i]]--;
+    }
+    for (int c = 0; c < HIST_SIZE; c++) {
+        d[c] = t[0][c] + t[1][c] + t[2][c] + t[3][c];
+    }
+}
+
+bool hist_all_zero(const int32_t *d)
+{
+    int32_t any = 0;
+
+    /* no early exit, so it stays a vector or */
+    for (int c = 0; c < HIST_SIZE; c++) {
+        any |= d[c];
+    }
+    return any == 0;
+}
+
+int hist_first_positive(const int32_t *d)
+{
+    for (int c = 0; c < HIST_SIZE; c++) {
+        if (d[c] > 0) {
+            return c;
+        }
+    }
+    return -1;
+}
+
+bool hist_covers(const uint32_t *big, const uint32_t *small)
+{
+    bool short_of = false;
+
+    for (int c = 0; c < HIST_SIZE; c++) {
+        short_of |= small[c] > big[c];
+    }
+    return !short_of;
+}
+
+size_t hist_sort_by_count(const uint32_t *h, char *out)
+{
+    uint8_t order[HIST_SIZE];
+    int n = 0;
+
+    /* insertion by count over at most 256 distinct bytes, stable so equal
+       counts keep byte order */
+    for (int c = 0; c < HIST_SIZE; c++) {
+        if (h[c] == 0) {
+            continue;
+        }
+        int j = n++;
+        while (j > 0 && h[order[j - 1]] < h[c]) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = (uint8_t)c;
+    }
+    size_t len = 0;
+    for (int k = 0; k < n; k++) {
+        memset(out + len, order[k], h[order[k]]);
+        len += h[order[k]];
+    }
+    return len;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file histogram.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief byte histograms for the character counting problems, counted
+ * into several tables so runs of one byte do not serialise on a single
+ * counter, compared, diffed and written back out in count order
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _HISTOGRAM_H_
+#define _HISTOGRAM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HIST_SIZE 256
+
+/**
+ * @brief h[c] = occurrences of byte c in s, below 2^32 per byte
+ *
+ * @param s
+ * @param len
+ * @param h HIST_SIZE counters, overwritten
+ */
+void hist_count(const char *s, size_t len, uint32_t *h);
+
+/**
+ * @brief d[c] = occurrences of c in a minus those in b, both len long,
+ * in one pass over the pair
+ *
+ * @param a
+ * @param b
+ * @param len below 2^31
+ * @param d HIST_SIZE counters, overwritten
+ */
+void hist_count_diff(const char *a, const char *b, size_t len, int32_t *d);
+
+/**
+ * @brief whether every counter of a difference is 0
+ *
+ * @param d HIST_SIZE counters
+ * @return true
+ * @return false
+ */
+bool hist_all_zero(const int32_t *d);
+
+/**
+ * @brief smallest byte with a positive difference
+ *
+ * @param d HIST_SIZE counters
+ * @return int the byte, -1 if there is none
+ */
+int hist_first_positive(const int32_t *d);
+
+/**
+ * @brief whether big has at least as many of every byte as small
+ *
+ * @param big HIST_SIZE counters
+ * @param small HIST_SIZE counters
+ * @return true
+ * @return false
+ */
+bool hist_covers(const uint32_t *big, const uint32_t *small);
+
+/**
+ * @brief write every byte h[c] times, more frequent bytes first and equal
+ * counts by byte value, no terminator
+ *
+ * @param h HIST_SIZE counters
+ * @param out room for the sum of h
+ * @return size_t bytes written
+ */
+size_t hist_sort_by_count(const uint32_t *h, char *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
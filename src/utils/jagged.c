@@ -0,0 +1,138 @@
+/**
+ * @file jagged.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "jagged.h"
+
+int jagged_init(jagged_t *jg, int rows_hint, size_t len_hint)
+{
+    memset(jg, 0, sizeof(jagged_t));
+    jg->rows_cap = rows_hint > 0 ? rows_hint : 16;
+    jg->cap = len_hint > 0 ? len_hint : 64;
+    jg->offs = (int *)malloc(sizeof(int) * (jg->rows_cap + 1));
+    jg->data = (int *)malloc(sizeof(int) * jg->cap);
+    if (jg->offs == NULL || jg->data == NULL) {
+        printf("Memory allocation failed.\n");
+        jagged_destroy(jg);
+        return -1;
+    }
+    jg->offs[0] = 0;
+    return 0;
+}
+
+void jagged_destroy(jagged_t *jg)
+{
+    free(jg->data);
+    free(jg->offs);
+    memset(jg, 0, sizeof(jagged_t));
+}
+
+int *jagged_begin_row(jagged_t *jg, int max)
+{
+    if (jg->offs == NULL && jagged_init(jg, 0, 0) != 0) {
+        return NULL;
+    }
+    if (jg->rows == jg->rows_cap) {
+        int cap = jg->rows_cap * 2;
+        int *offs = (int *)realloc(jg->offs, sizeof(int) * (cap + 1));
+        if (offs == NULL) {
+            printf("Memory allocation failed.\n");
+            return NULL;
+        }
+        jg->offs = offs;
+        jg->rows_cap = cap;
+    }
+    if (jg->len + max > jg->cap) {
+        size_t cap = jg->cap * 2;
+        while (cap < jg->len + max) {
+            cap *= 2;
+        }
+        int *data = (int *)realloc(jg->data, sizeof(int) * cap);
+        if (data == NULL) {
+            printf("Memory allocation failed.\n");
+            return NULL;
+        }
+        jg->data = data;
+        jg->cap = cap;
+    }
+    return jg->data + jg->len;
+}
+
+void jagged_end_row(jagged_t *jg, int n)
+{
+    jg->len += n;
+    jg->offs[++jg->rows] = (int)jg->len;
+}
+
+int jagged_push(jagged_t *jg, const int *row, int n)
+{
+    int *dst = jagged_begin_row(jg, n);
+    if (dst == NULL) {
+        return -1;
+    }
+    memcpy(dst, row, sizeof(int) * n);
+    jagged_end_row(jg, n);
+    return 0;
+}
+
+int **jagged_export(jagged_t *jg, int *returnSize, int **returnColumnSizes)
+{
+    int rows = jg->rows;
+    int **ret =
+        (int **)malloc(sizeof(int *) * rows + sizeof(int) * jg->len + 1);
+    if (ret == NULL) {
+        printf("Memory allocation failed.\n");
+        return NULL;
+    }
+    int *data = (int *)(ret + rows);
+    if (jg->len > 0) {
+        memcpy(data, jg->data, sizeof(int) * jg->len);
+    }
+    /* offsets turn into sizes in place, offs[r + 1] is read before slot
+       r + 1 is written */
+    int *sizes = jg->offs;
+    for (int r = 0; r < rows; r++) {
+        ret[r] = data + sizes[r];
+        sizes[r] = sizes[r + 1] - sizes[r];
+    }
+    *returnSize = rows;
+    *returnColumnSizes = sizes;
+    jg->offs = NULL;
+    jagged_destroy(jg);
+    return ret;
+}
+
+int **jagged_export_fixed(const int *data, int rows, int cols,
+                          int *returnSize, int **returnColumnSizes)
+{
+    size_t len = (size_t)rows * cols;
+    int **ret = (int **)malloc(sizeof(int *) * rows + sizeof(int) * len + 1);
+    int *sizes = (int *)malloc(sizeof(int) * rows + 1);
+    if (ret == NULL || sizes == NULL) {
+        printf("Memory allocation failed.\n");
+        free(ret);
+        free(sizes);
+        return NULL;
+    }
+    int *dst = (int *)(ret + rows);
+    if (len > 0) {
+        memcpy(dst, data, sizeof(int) * len);
+    }
+    for (int r = 0; r < rows; r++) {
+        ret[r] = dst + (size_t)r * cols;
+        sizes[r] = cols;
+    }
+    *returnSize = rows;
+    *returnColumnSizes = sizes;
+    return ret;
+}
@@ -0,0 +1,116 @@
+/**
+ * @file jagged.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief jagged int array, rows live back to back in one buffer with an
+ * offsets array, exported to the "int **, returnColumnSizes" signature
+ * with two allocations
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _JAGGED_H_
+#define _JAGGED_H_
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    int *data; /* rows back to back */
+    size_t len; /* ints in committed rows */
+    size_t cap;
+    int *offs; /* rows + 1 entries, row r is data[offs[r]..offs[r + 1]) */
+    int rows;
+    int rows_cap;
+} jagged_t;
+
+/**
+ * @brief empty array, the hints size the first allocations so a result
+ * of known shape never grows
+ *
+ * @param jg
+ * @param rows_hint
+ * @param len_hint total ints over all rows
+ * @return int 0 on success, -1 on allocation failure
+ */
+int jagged_init(jagged_t *jg, int rows_hint, size_t len_hint);
+
+/**
+ * @brief free the buffers, a no-op after jagged_export
+ *
+ * @param jg
+ */
+void jagged_destroy(jagged_t *jg);
+
+/**
+ * @brief reserve room for a new row of at most max ints, fill it and
+ * commit with jagged_end_row, the pointer is valid until the next begin
+ *
+ * @param jg
+ * @param max
+ * @return int* NULL on allocation failure
+ */
+int *jagged_begin_row(jagged_t *jg, int max);
+
+/**
+ * @brief commit the row opened by jagged_begin_row
+ *
+ * @param jg
+ * @param n ints written, n <= max
+ */
+void jagged_end_row(jagged_t *jg, int n);
+
+/**
+ * @brief append a copy of row
+ *
+ * @param jg
+ * @param row
+ * @param n
+ * @return int 0 on success, -1 on allocation failure
+ */
+int jagged_push(jagged_t *jg, const int *row, int n);
+
+static inline int *jagged_row(const jagged_t *jg, int r)
+{
+    return jg->data + jg->offs[r];
+}
+
+static inline int jagged_row_len(const jagged_t *jg, int r)
+{
+    return jg->offs[r + 1] - jg->offs[r];
+}
+
+/**
+ * @brief hand the rows over in the LeetCode layout and empty jg, the row
+ * pointers and the ints share one block so free(ret) releases both, the
+ * column sizes are the other allocation
+ *
+ * @param jg
+ * @param returnSize
+ * @param returnColumnSizes
+ * @return int** NULL on allocation failure, jg is left intact then
+ */
+int **jagged_export(jagged_t *jg, int *returnSize, int **returnColumnSizes);
+
+/**
+ * @brief same layout from rows of equal width stored back to back
+ *
+ * @param data rows * cols ints
+ * @param rows
+ * @param cols
+ * @param returnSize
+ * @param returnColumnSizes
+ * @return int** NULL on allocation failure
+ */
+int **jagged_export_fixed(const int *data, int rows, int cols,
+                          int *returnSize, int **returnColumnSizes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
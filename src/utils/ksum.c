@@ -0,0 +1,268 @@
+/**
+ * @file ksum.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "utils.h"
+#include "ksum.h"
+
+#define KSUM_CHUNK 16 /* first elements per parallel work item */
+
+void ksum_result_init(ksum_result_t *r, int k)
+{
+    memset(r, 0, sizeof(ksum_result_t));
+    r->k = k;
+}
+
+void ksum_result_destroy(ksum_result_t *r)
+{
+    free(r->data);
+    r->data = NULL;
+    r->count = 0;
+    r->cap = 0;
+}
+
+static int emit(ksum_result_t *r, const int *prefix, int depth, int a, int b)
+{
+    if (r->count == r->cap) {
+        size_t cap = r->cap ? r->cap * 2 : 64;
+        int *data = (int *)realloc(r->data, sizeof(int) * r->k * cap);
+        if (data == NULL) {
+            printf("Memory allocation failed.\n");
+            return -1;
+        }
+        r->data = data;
+        r->cap = cap;
+    }
+    int *t = r->data + r->count * r->k;
+    memcpy(t, prefix, sizeof(int) * depth);
+    t[depth] = a;
+    t[depth + 1] = b;
+    r->count++;
+    return 0;
+}
+
+static int find_from(const int *a, int lo, int i, int n, int k,
+                     int64_t target, int *prefix, int depth,
+                     ksum_result_t *out);
+
+/* the prefix holds the depth elements already chosen */
+static int find_rec(const int *a, int lo, int n, int k, int64_t target,
+                    int *prefix, int depth, ksum_result_t *out)
+{
+    if (k == 2) {
+        int l = lo, r = n - 1;
+        while (l < r) {
+            int64_t sum = (int64_t)a[l] + a[r];
+            if (sum < target) {
+                l++;
+            } else if (sum > target) {
+                r--;
+            } else {
+                if (emit(out, prefix, depth, a[l], a[r]) != 0) {
+                    return -1;
+                }
+                while (l < r && a[l] == a[l + 1]) {
+                    l++;
+                }
+                while (l < r && a[r] == a[r - 1]) {
+                    r--;
+                }
+                l++;
+                r--;
+            }
+        }
+        return 0;
+    }
+
+    for (int i = lo; i <= n - k; i++) {
+        int ret = find_from(a, lo, i, n, k, target, prefix, depth, out);
+        if (ret != 0) {
+            return ret < 0 ? -1 : 0;
+        }
+    }
+    return 0;
+}
+
+/* fix a[i] as the next element and recurse, 1 once no larger i can
+   reach target, -1 on allocation failure */
+static int find_from(const int *a, int lo, int i, int n, int k,
+                     int64_t target, int *prefix, int depth,
+                     ksum_result_t *out)
+{
+    if (i > lo && a[i] == a[i - 1]) {
+        return 0;
+    }
+    /* the k smallest from i already overshoot, later i only grow */
+    int64_t low = 0, high = a[i];
+    for (int j = 0; j < k; j++) {
+        low += a[i + j];
+    }
+    if (low > target) {
+        return 1;
+    }
+    for (int j = 1; j < k; j++) {
+        high += a[n - j];
+    }
+    if (high < target) {
+        return 0;
+    }
+    prefix[depth] = a[i];
+    return find_rec(a, i + 1, n, k - 1, target - a[i], prefix, depth + 1,
+                    out);
+}
+
+int ksum_find(const int *sorted, int n, int k, int64_t target,
+              ksum_result_t *out)
+{
+    int prefix[KSUM_MAX_K];
+
+    if (k < 2 || k > KSUM_MAX_K || out->k != k) {
+        return -1;
+    }
+    return find_rec(sorted, 0, n, k, target, prefix, 0, out);
+}
+
+typedef struct {
+    const int *a;
+    int n;
+    int k;
+    int64_t target;
+    int chunks;
+    int next; /* next chunk to take */
+    int failed;
+    ksum_result_t *results; /* one per chunk, concatenated in order */
+} ksum_job_t;
+
+static void *ksum_worker(void *arg)
+{
+    ksum_job_t *job = (ksum_job_t *)arg;
+    int prefix[KSUM_MAX_K];
+    int c;
+
+    while ((c = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED)) <
+           job->chunks) {
+        int end = MIN((c + 1) * KSUM_CHUNK, job->n - job->k + 1);
+        for (int i = c * KSUM_CHUNK; i < end; i++) {
+            int ret = find_from(job->a, 0, i, job->n, job->k, job->target,
+                                prefix, 0, &job->results[c]);
+            if (ret < 0) {
+                __atomic_store_n(&job->failed, 1, __ATOMIC_RELAXED);
+                return NULL;
+            }
+            if (ret > 0) {
+                break;
+            }
+        }
+    }
+    return NULL;
+}
+
+int ksum_find_parallel(const int *sorted, int n, int k, int64_t target,
+                       ksum_result_t *out, int threads)
+{
+    if (k < 3 || threads <= 1 || n < k) {
+        return ksum_find(sorted, n, k, target, out);
+    }
+    if (k > KSUM_MAX_K || out->k != k) {
+        return -1;
+    }
+
+    ksum_job_t job;
+    job.a = sorted;
+    job.n = n;
+    job.k = k;
+    job.target = target;
+    job.chunks = (n - k + 1 + KSUM_CHUNK - 1) / KSUM_CHUNK;
+    job.next = 0;
+    job.failed = 0;
+    job.results = (ksum_result_t *)malloc(sizeof(ksum_result_t) * job.chunks);
+    pthread_t *tids = (pthread_t *)malloc(sizeof(pthread_t) * threads);
+    if (job.results == NULL || tids == NULL) {
+        printf("Memory allocation failed.\n");
+        free(job.results);
+        free(tids);
+        return -1;
+    }
+    for (int c = 0; c < job.chunks; c++) {
+        ksum_result_init(&job.results[c], k);
+    }
+
+    /* the calling thread is one of the workers */
+    int started = 0;
+    for (; started < threads - 1; started++) {
+        if (pthread_create(&tids[started], NULL, ksum_worker, &job) != 0) {
+            break;
+        }
+    }
+    ksum_worker(&job);
+    for (int t = 0; t < started; t++) {
+        pthread_join(tids[t], NULL);
+    }
+
+    /* one append of the right size keeps the sequential order */
+    size_t total = out->count;
+    for (int c = 0; c < job.chunks; c++) {
+        total += job.results[c].count;
+    }
+    if (!job.failed && total > out->cap) {
+        int *data = (int *)realloc(out->data, sizeof(int) * k * total);
+        if (data == NULL) {
+            printf("Memory allocation failed.\n");
+            job.failed = 1;
+        } else {
+            out->data = data;
+            out->cap = total;
+        }
+    }
+    for (int c = 0; c < job.chunks; c++) {
+        ksum_result_t *r = &job.results[c];
+        if (!job.failed && r->count > 0) {
+            memcpy(out->data + out->count * k, r->data,
+                   sizeof(int) * k * r->count);
+            out->count += r->count;
+        }
+        ksum_result_destroy(r);
+    }
+    free(job.results);
+    free(tids);
+    return job.failed ? -1 : 0;
+}
+
+int64_t ksum_closest3(const int *sorted, int n, int64_t target)
+{
+    int64_t best = (int64_t)sorted[0] + sorted[1] + sorted[2];
+
+    for (int i = 0; i < n - 2; i++) {
+        if (i > 0 && sorted[i] == sorted[i - 1]) {
+            continue;
+        }
+        int l = i + 1, r = n - 1;
+        while (l < r) {
+            int64_t sum = (int64_t)sorted[i] + sorted[l] + sorted[r];
+            int64_t d = sum > target ? sum - target : target - sum;
+            int64_t bd = best > target ? best - target : target - best;
+            if (d < bd || (d == bd && sum < best)) {
+                best = sum;
+            }
+            if (sum < target) {
+                l++;
+            } else if (sum > target) {
+                r--;
+            } else {
+                return sum;
+            }
+        }
+    }
+    return best;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file ksum.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief k-sum over a sorted int array, unique tuples written to one flat
+ * growing buffer, with an optional multi-threaded outer loop
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _KSUM_H_
+#define _KSUM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define KSUM_MAX_K 8
+
+/* tuple i is data[i * k .. i * k + k - 1], ascending within the tuple */
+typedef struct {
+    int k;
+    size_t count;
+    size_t cap; /* tuples */
+    int *data;
+} ksum_result_t;
+
+/**
+ * @brief init an empty result
+ *
+ * @param r
+ * @param k tuple size
+ */
+void ksum_result_init(ksum_result_t *r, int k);
+
+/**
+ * @brief free the buffer
+ *
+ * @param r
+ */
+void ksum_result_destroy(ksum_result_t *r);
+
+/**
+ * @brief every distinct k-tuple of sorted summing to target, in
+ * lexicographic order, O(n^(k-1))
+ *
+ * @param sorted ascending
+ * @param n
+ * @param k 2..KSUM_MAX_K
+ * @param target
+ * @param out appended to, initialised with the same k
+ * @return int 0 on success, -1 on bad k or allocation failure
+ */
+int ksum_find(const int *sorted, int n, int k, int64_t target,
+              ksum_result_t *out);
+
+/**
+ * @brief ksum_find with the first element spread over threads, same output
+ * and order
+ *
+ * @param sorted
+ * @param n
+ * @param k 3..KSUM_MAX_K, smaller k runs on the calling thread
+ * @param target
+ * @param out
+ * @param threads
+ * @return int 0 on success, -1 on error
+ */
+int ksum_find_parallel(const int *sorted, int n, int k, int64_t target,
+                       ksum_result_t *out, int threads);
+
+/**
+ * @brief sum of three elements closest to target, the smaller one on a tie,
+ * O(n^2)
+ *
+ * @param sorted ascending
+ * @param n >= 3
+ * @param target
+ * @return int64_t
+ */
+int64_t ksum_closest3(const int *sorted, int n, int64_t target);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,112 @@
+/**
+ * @file kth_select.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+
+#include "utils.h"
+#include "kth_select.h"
+
+int kth_of_two(const int *a, size_t n, const int *b, size_t m, size_t k)
+{
+    /* search the split of the shorter array */
+    if (n > m) {
+        const int *t = a;
+        a = b;
+        b = t;
+        size_t l = n;
+        n = m;
+        m = l;
+    }
+
+    /* take i from a and j = k + 1 - i from b, the right i is the first
+       with a[i] >= b[j - 1] */
+    size_t lo = k + 1 > m ? k + 1 - m : 0;
+    size_t hi = MIN(n, k + 1);
+    while (lo < hi) {
+        size_t i = lo + (hi - lo) / 2;
+        if (a[i] < b[k - i]) {
+            lo = i + 1;
+        } else {
+            hi = i;
+        }
+    }
+
+    size_t j = k + 1 - lo;
+    if (lo == 0) {
+        return b[j - 1];
+    }
+    if (j == 0) {
+        return a[lo - 1];
+    }
+    return MAX(a[lo - 1], b[j - 1]);
+}
+
+double median_of_two(const int *a, size_t n, const int *b, size_t m)
+{
+    size_t total = n + m;
+    int hi = kth_of_two(a, n, b, m, total / 2);
+
+    if (total % 2 != 0) {
+        return hi;
+    }
+    int lo = kth_of_two(a, n, b, m, total / 2 - 1);
+    return ((int64_t)lo + hi) / 2.0;
+}
+
+/* elements <= x in one ascending array */
+static size_t count_le(const int *a, size_t n, int x)
+{
+    size_t lo = 0, hi = n;
+
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (a[mid] <= x) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+int kth_of_many(const int *const *arrays, const size_t *sizes, int count,
+                uint64_t k, int *value)
+{
+    uint64_t total = 0;
+    int64_t lo = INT_MAX, hi = INT_MIN;
+
+    for (int i = 0; i < count; i++) {
+        if (sizes[i] == 0) {
+            continue;
+        }
+        total += sizes[i];
+        lo = MIN(lo, (int64_t)arrays[i][0]);
+        hi = MAX(hi, (int64_t)arrays[i][sizes[i] - 1]);
+    }
+    if (k >= total) {
+        return -1;
+    }
+
+    /* smallest x with more than k elements <= x */
+    while (lo < hi) {
+        int64_t mid = lo + (hi - lo) / 2;
+        uint64_t le = 0;
+        for (int i = 0; i < count; i++) {
+            le += count_le(arrays[i], sizes[i], (int)mid);
+        }
+        if (le > k) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    *value = (int)lo;
+    return 0;
+}
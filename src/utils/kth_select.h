@@ -0,0 +1,65 @@
+/**
+ * @file kth_select.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief k-th smallest of sorted arrays in place, binary partitioning for
+ * two arrays and a value search for any number of them, no merging
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _KTH_SELECT_H_
+#define _KTH_SELECT_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief k-th smallest of the union of two ascending arrays,
+ * O(log(min(n, m)))
+ *
+ * @param a
+ * @param n
+ * @param b
+ * @param m
+ * @param k 0-based, less than n + m
+ * @return int
+ */
+int kth_of_two(const int *a, size_t n, const int *b, size_t m, size_t k);
+
+/**
+ * @brief median of the union of two ascending arrays
+ *
+ * @param a
+ * @param n
+ * @param b
+ * @param m
+ * @return double mean of the two middle values for an even total
+ */
+double median_of_two(const int *a, size_t n, const int *b, size_t m);
+
+/**
+ * @brief k-th smallest of the union of count ascending arrays, searches the
+ * value range, O(count * log(size) * 32)
+ *
+ * @param arrays
+ * @param sizes
+ * @param count
+ * @param k 0-based
+ * @param value
+ * @return int 0 on success, -1 if k is not below the total size
+ */
+int kth_of_many(const int *const *arrays, const size_t *sizes, int count,
+                uint64_t k, int *value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,207 @@
+/**
+ * @file linrec.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "utils.h"
+#include "linrec.h"
+
+/* every fibonacci and tribonacci number below 2^64, written out so the
+   small indexes the problems ask for cost one load */
+static const uint64_t fib_table[] = {
+    0ULL, 1ULL, 1ULL, 2ULL, 3ULL, 5ULL, 8ULL, 13ULL, 21ULL, 34ULL, 55ULL,
+    89ULL, 144ULL, 233ULL, 377ULL, 610ULL, 987ULL, 1597ULL, 2584ULL, 4181ULL,
+    6765ULL, 10946ULL, 17711ULL, 28657ULL, 46368ULL, 75025ULL, 121393ULL,
+    196418ULL, 317811ULL, 514229ULL, 832040ULL, 1346269ULL, 2178309ULL,
+    3524578ULL, 5702887ULL, 9227465ULL, 14930352ULL, 24157817ULL, 39088169ULL,
+    63245986ULL, 102334155ULL, 165580141ULL, 267914296ULL, 433494437ULL,
+    701408733ULL, 1134903170ULL, 1836311903ULL, 2971215073ULL, 4807526976ULL,
+    7778742049ULL, 12586269025ULL, 20365011074ULL, 32951280099ULL,
+    53316291173ULL, 86267571272ULL, 139583862445ULL, 225851433717ULL,
+    365435296162ULL, 591286729879ULL, 956722026041ULL, 1548008755920ULL,
+    2504730781961ULL, 4052739537881ULL, 6557470319842ULL, 10610209857723ULL,
+    17167680177565ULL, 27777890035288ULL, 44945570212853ULL, 72723460248141ULL,
+    117669030460994ULL, 190392490709135ULL, 308061521170129ULL,
+    498454011879264ULL, 806515533049393ULL, 1304969544928657ULL,
+    2111485077978050ULL, 3416454622906707ULL, 5527939700884757ULL,
+    8944394323791464ULL, 14472334024676221ULL, 23416728348467685ULL,
+    37889062373143906ULL, 61305790721611591ULL, 99194853094755497ULL,
+    160500643816367088ULL, 259695496911122585ULL, 420196140727489673ULL,
+    679891637638612258ULL, 1100087778366101931ULL, 1779979416004714189ULL,
+    2880067194370816120ULL, 4660046610375530309ULL, 7540113804746346429ULL,
+    12200160415121876738ULL,
+};
+
+static const uint64_t trib_table[] = {
+    0ULL, 1ULL, 1ULL, 2ULL, 4ULL, 7ULL, 13ULL, 24ULL, 44ULL, 81ULL, 149ULL,
+    274ULL, 504ULL, 927ULL, 1705ULL, 3136ULL, 5768ULL, 10609ULL, 19513ULL,
+    35890ULL, 66012ULL, 121415ULL, 223317ULL, 410744ULL, 755476ULL, 1389537ULL,
+    2555757ULL, 4700770ULL, 8646064ULL, 15902591ULL, 29249425ULL, 53798080ULL,
+    98950096ULL, 181997601ULL, 334745777ULL, 615693474ULL, 1132436852ULL,
+    2082876103ULL, 3831006429ULL, 7046319384ULL, 12960201916ULL,
+    23837527729ULL, 43844049029ULL, 80641778674ULL, 148323355432ULL,
+    272809183135ULL, 501774317241ULL, 922906855808ULL, 1697490356184ULL,
+    3122171529233ULL, 5742568741225ULL, 10562230626642ULL, 19426970897100ULL,
+    35731770264967ULL, 65720971788709ULL, 120879712950776ULL,
+    222332455004452ULL, 408933139743937ULL, 752145307699165ULL,
+    1383410902447554ULL, 2544489349890656ULL, 4680045560037375ULL,
+    8607945812375585ULL, 15832480722303616ULL, 29120472094716576ULL,
+    53560898629395777ULL, 98513851446415969ULL, 181195222170528322ULL,
+    333269972246340068ULL, 612979045863284359ULL, 1127444240280152749ULL,
+    2073693258389777176ULL, 3814116544533214284ULL, 7015254043203144209ULL,
+    12903063846126135669ULL,
+};
+
+typedef uint64_t mat_t[LINREC_MAX_ORDER][LINREC_MAX_ORDER];
+
+/* operands below mod < 2^63, so a sum never wraps */
+static inline uint64_t add_mod(uint64_t a, uint64_t b, uint64_t mod)
+{
+    if (mod == 0) {
+        return a + b;
+    }
+    uint64_t s = a + b;
+    return s >= mod ? s - mod : s;
+}
+
+static inline uint64_t mul_mod(uint64_t a, uint64_t b, uint64_t mod)
+{
+    if (mod == 0) {
+        return a * b;
+    }
+#if defined(__SIZEOF_INT128__)
+    return (uint64_t)((unsigned __int128)a * b % mod);
+#else
+    /* shift and add, a and b below mod < 2^63 so nothing wraps */
+    uint64_t r = 0;
+    for (; b > 0; b >>= 1) {
+        if (b & 1) {
+            r = add_mod(r, a, mod);
+        }
+        a = add_mod(a, a, mod);
+    }
+    return r;
+#endif
+}
+
+/* r = a * b, r may alias neither */
+static void mat_mul(mat_t r, const mat_t a, const mat_t b, int k, uint64_t mod)
+{
+    for (int i = 0; i < k; i++) {
+        for (int j = 0; j < k; j++) {
+            uint64_t s = 0;
+            for (int x = 0; x < k; x++) {
+                s = add_mod(s, mul_mod(a[i][x], b[x][j], mod), mod);
+            }
+            r[i][j] = s;
+        }
+    }
+}
+
+/* v = m * v */
+static void mat_vec(const mat_t m, uint64_t *v, int k, uint64_t mod)
+{
+    uint64_t r[LINREC_MAX_ORDER];
+
+    for (int i = 0; i < k; i++) {
+        uint64_t s = 0;
+        for (int x = 0; x < k; x++) {
+            s = add_mod(s, mul_mod(m[i][x], v[x], mod), mod);
+        }
+        r[i] = s;
+    }
+    memcpy(v, r, sizeof(uint64_t) * k);
+}
+
+int linrec_init(linrec_t *lr, int k, const uint64_t *coef,
+                const uint64_t *init, uint64_t mod)
+{
+    if (k < 1 || k > LINREC_MAX_ORDER || mod >= (1ULL << 63)) {
+        return -1;
+    }
+    memset(lr, 0, sizeof(linrec_t));
+    lr->k = k;
+    lr->mod = mod;
+    for (int i = 0; i < k; i++) {
+        lr->coef[i] = mod ? coef[i] % mod : coef[i];
+        lr->init[i] = mod ? init[i] % mod : init[i];
+    }
+    return 0;
+}
+
+uint64_t linrec_nth(const linrec_t *lr, uint64_t n)
+{
+    int k = lr->k;
+    uint64_t mod = lr->mod;
+
+    if (n < (uint64_t)k) {
+        return lr->init[n];
+    }
+
+    /* companion matrix, it maps (a(i), .., a(i - k + 1)) one step on */
+    mat_t p, sq;
+    memset(p, 0, sizeof(mat_t));
+    for (int j = 0; j < k; j++) {
+        p[0][j] = lr->coef[j];
+    }
+    for (int i = 1; i < k; i++) {
+        p[i][i - 1] = 1;
+    }
+
+    /* powers of one matrix commute, so the vector takes the set bits of
+       e from the low end and only the squarings are k^3 */
+    uint64_t v[LINREC_MAX_ORDER];
+    for (int i = 0; i < k; i++) {
+        v[i] = lr->init[k - 1 - i];
+    }
+    for (uint64_t e = n - (k - 1);;) {
+        if (e & 1) {
+            mat_vec(p, v, k, mod);
+        }
+        e >>= 1;
+        if (e == 0) {
+            break;
+        }
+        mat_mul(sq, p, p, k, mod);
+        memcpy(p, sq, sizeof(mat_t));
+    }
+    return v[0];
+}
+
+uint64_t linrec_fib(uint64_t n, uint64_t mod)
+{
+    static const uint64_t coef[] = {1, 1};
+    static const uint64_t init[] = {0, 1};
+    linrec_t lr;
+
+    if (n < ARRAY_SIZE(fib_table)) {
+        return mod ? fib_table[n] % mod : fib_table[n];
+    }
+    if (linrec_init(&lr, 2, coef, init, mod) != 0) {
+        return 0;
+    }
+    return linrec_nth(&lr, n);
+}
+
+uint64_t linrec_tribonacci(uint64_t n, uint64_t mod)
+{
+    static const uint64_t coef[] = {1, 1, 1};
+    static const uint64_t init[] = {0, 1, 1};
+    linrec_t lr;
+
+    if (n < ARRAY_SIZE(trib_table)) {
+        return mod ? trib_table[n] % mod : trib_table[n];
+    }
+    if (linrec_init(&lr, 3, coef, init, mod) != 0) {
+        return 0;
+    }
+    return linrec_nth(&lr, n);
+}
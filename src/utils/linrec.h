@@ -0,0 +1,78 @@
+/**
+ * @file linrec.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief constant coefficient linear recurrences, the n-th term of any
+ * order k recurrence by powering its companion matrix in O(k^3 log n) and
+ * O(1) memory, modulo p or wrapping modulo 2^64, plus fibonacci and
+ * tribonacci with tables of every term that fits in 64 bits
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _LINREC_H_
+#define _LINREC_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LINREC_MAX_ORDER 8
+
+/* a(n) = coef[0] * a(n - 1) + ... + coef[k - 1] * a(n - k) */
+typedef struct {
+    int k;
+    uint64_t mod; /* 0 for arithmetic modulo 2^64 */
+    uint64_t coef[LINREC_MAX_ORDER];
+    uint64_t init[LINREC_MAX_ORDER]; /* a(0) .. a(k - 1) */
+} linrec_t;
+
+/**
+ * @brief set up a recurrence, coefficients and initial terms are reduced
+ * modulo mod
+ *
+ * @param lr
+ * @param k order, 1 .. LINREC_MAX_ORDER
+ * @param coef k coefficients, the one of a(n - 1) first
+ * @param init a(0) .. a(k - 1)
+ * @param mod 0 for modulo 2^64, else below 2^63
+ * @return int 0 on success, -1 on a bad order or modulus
+ */
+int linrec_init(linrec_t *lr, int k, const uint64_t *coef,
+                const uint64_t *init, uint64_t mod);
+
+/**
+ * @brief a(n), O(k^3 log n) multiplications and no allocation
+ *
+ * @param lr
+ * @param n
+ * @return uint64_t
+ */
+uint64_t linrec_nth(const linrec_t *lr, uint64_t n);
+
+/**
+ * @brief F(n) with F(0) = 0, F(1) = 1, a table lookup for n <= 93
+ *
+ * @param n
+ * @param mod 0 for modulo 2^64, else below 2^63
+ * @return uint64_t
+ */
+uint64_t linrec_fib(uint64_t n, uint64_t mod);
+
+/**
+ * @brief T(n) with T(0) = 0, T(1) = T(2) = 1, a table lookup for n <= 74
+ *
+ * @param n
+ * @param mod 0 for modulo 2^64, else below 2^63
+ * @return uint64_t
+ */
+uint64_t linrec_tribonacci(uint64_t n, uint64_t mod);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
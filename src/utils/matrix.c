@@ -0,0 +1,385 @@
+/**
+ * @file matrix.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "utils.h"
+#include "matrix.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define MATRIX_AVX2 1
+#endif
+
+/* rows by columns of the blocks the diagonal traversal walks, small
+   enough that the rows read and the diagonals written stay in cache */
+#define MATRIX_DIAG_TILE 64
+
+int matrix_view_open(matrix_view_t *v, int **rows, size_t nrows, size_t cols)
+{
+    v->data = nrows > 0 ? rows[0] : NULL;
+    v->rows = nrows;
+    v->cols = cols;
+    v->ld = cols;
+    v->src = NULL;
+    if (nrows < 2) {
+        return 0;
+    }
+
+    uintptr_t base = (uintptr_t)rows[0];
+    uintptr_t step = (uintptr_t)rows[1] - base;
+    bool even = rows[1] > rows[0] && step % sizeof(int) == 0 &&
+                step / sizeof(int) >= cols;
+    for (size_t i = 2; i < nrows && even; i++) {
+        even = (uintptr_t)rows[i] == base + i * step;
+    }
+    if (even) {
+        v->ld = step / sizeof(int);
+        return 0;
+    }
+
+    v->data = (int *)malloc(sizeof(int) * nrows * cols);
+    if (v->data == NULL) {
+        printf("Memory allocation failed.\n");
+        return -1;
+    }
+    for (size_t i = 0; i < nrows; i++) {
+        memcpy(v->data + i * cols, rows[i], sizeof(int) * cols);
+    }
+    v->src = rows;
+    return 0;
+}
+
+void matrix_view_close(matrix_view_t *v, bool write_back)
+{
+    if (v->src == NULL) {
+        return;
+    }
+    if (write_back) {
+        for (size_t i = 0; i < v->rows; i++) {
+            memcpy(v->src[i], v->data + i * v->cols, sizeof(int) * v->cols);
+        }
+    }
+    free(v->data);
+    v->data = NULL;
+    v->src = NULL;
+}
+
+/* ---- transpose ---- */
+
+static bool has_avx2(void)
+{
+#if defined(MATRIX_AVX2)
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+/* a[i][j] <-> b[j][i] for the r x c block at a and the c x r block at b */
+static void swap_scalar(int *a, int *b, size_t r, size_t c, size_t ld,
+                        size_t r_done, size_t c_done)
+{
+    for (size_t i = 0; i < r; i++) {
+        for (size_t j = i < r_done ? c_done : 0; j < c; j++) {
+            int t = a[i * ld + j];
+            a[i * ld + j] = b[j * ld + i];
+            b[j * ld + i] = t;
+        }
+    }
+}
+
+static void diag_scalar(int *a, size_t n, size_t ld, size_t done)
+{
+    for (size_t i = done; i < n; i++) {
+        for (size_t j = 0; j < i; j++) {
+            int t = a[i * ld + j];
+            a[i * ld + j] = a[j * ld + i];
+            a[j * ld + i] = t;
+        }
+    }
+}
+
+#if defined(MATRIX_AVX2)
+__attribute__((target("avx2"))) static inline void transpose8(__m256i *r)
+{
+    __m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+    __m256i t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+    __m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+    __m256i t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+    __m256i t4 = _mm256_unpacklo_epi32(r[4], r[5]);
+    __m256i t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+    __m256i t6 = _mm256_unpacklo_epi32(r[6], r[7]);
+    __m256i t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+    __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+    __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+    __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+    __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+    __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+    __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+    __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+    __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+    r[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+    r[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+    r[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+    r[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+    r[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+    r[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+    r[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+    r[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+/* transpose the 8x8 blocks at a and b into each other's place */
+__attribute__((target("avx2"))) static inline void swap8(int *a, int *b,
+                                                         size_t ld)
+{
+    __m256i x[8], y[8];
+
+    for (int k = 0; k < 8; k++) {
+        x[k] = _mm256_loadu_si256((const __m256i *)(a + k * ld));
+        y[k] = _mm256_loadu_si256((const __m256i *)(b + k * ld));
+    }
+    transpose8(x);
+    transpose8(y);
+    for (int k = 0; k < 8; k++) {
+        _mm256_storeu_si256((__m256i *)(a + k * ld), y[k]);
+        _mm256_storeu_si256((__m256i *)(b + k * ld), x[k]);
+    }
+}
+
+__attribute__((target("avx2"))) static inline void diag8(int *a, size_t ld)
+{
+    __m256i x[8];
+
+    for (int k = 0; k < 8; k++) {
+        x[k] = _mm256_loadu_si256((const __m256i *)(a + k * ld));
+    }
+    transpose8(x);
+    for (int k = 0; k < 8; k++) {
+        _mm256_storeu_si256((__m256i *)(a + k * ld), x[k]);
+    }
+}
+
+__attribute__((target("avx2"))) static void
+swap_avx2(int *a, int *b, size_t r, size_t c, size_t ld)
+{
+    size_t r8 = r & ~(size_t)7, c8 = c & ~(size_t)7;
+
+    for (size_t i = 0; i < r8; i += 8) {
+        for (size_t j = 0; j < c8; j += 8) {
+            swap8(a + i * ld + j, b + j * ld + i, ld);
+        }
+    }
+    swap_scalar(a, b, r, c, ld, r8, c8);
+}
+
+__attribute__((target("avx2"))) static void diag_avx2(int *a, size_t n,
+                                                      size_t ld)
+{
+    size_t n8 = n & ~(size_t)7;
+
+    for (size_t i = 0; i < n8; i += 8) {
+        diag8(a + i * ld + i, ld);
+        for (size_t j = 0; j < i; j += 8) {
+            swap8(a + i * ld + j, a + j * ld + i, ld);
+        }
+    }
+    diag_scalar(a, n, ld, n8);
+}
+#endif
+
+static void swap_leaf(int *a, int *b, size_t r, size_t c, size_t ld)
+{
+#if defined(MATRIX_AVX2)
+    if (r >= 8 && c >= 8 && has_avx2()) {
+        swap_avx2(a, b, r, c, ld);
+        return;
+    }
+#endif
+    swap_scalar(a, b, r, c, ld, 0, 0);
+}
+
+static void diag_leaf(int *a, size_t n, size_t ld)
+{
+#if defined(MATRIX_AVX2)
+    if (n >= 8 && has_avx2()) {
+        diag_avx2(a, n, ld);
+        return;
+    }
+#endif
+    diag_scalar(a, n, ld, 0);
+}
+
+/* halve the longer side, on multiples of 8 so the leaves stay whole
+   kernels, until the block is one leaf */
+static void swap_rec(int *a, int *b, size_t r, size_t c, size_t ld)
+{
+    if (r <= MATRIX_LEAF && c <= MATRIX_LEAF) {
+        swap_leaf(a, b, r, c, ld);
+        return;
+    }
+    if (r >= c) {
+        size_t h = (r / 2) & ~(size_t)7;
+        swap_rec(a, b, h, c, ld);
+        swap_rec(a + h * ld, b + h, r - h, c, ld);
+    } else {
+        size_t h = (c / 2) & ~(size_t)7;
+        swap_rec(a, b, r, h, ld);
+        swap_rec(a + h, b + h * ld, r, c - h, ld);
+    }
+}
+
+static void diag_rec(int *a, size_t n, size_t ld)
+{
+    if (n <= MATRIX_LEAF) {
+        diag_leaf(a, n, ld);
+        return;
+    }
+    size_t h = (n / 2) & ~(size_t)7;
+    diag_rec(a, h, ld);
+    diag_rec(a + h * ld + h, n - h, ld);
+    swap_rec(a + h, a + h * ld, h, n - h, ld);
+}
+
+void matrix_transpose(int *a, size_t n, size_t ld)
+{
+    diag_rec(a, n, ld);
+}
+
+void matrix_flip_rows(int *a, size_t rows, size_t cols, size_t ld)
+{
+    int tmp[256];
+
+    for (size_t i = 0; i < rows / 2; i++) {
+        int *x = a + i * ld;
+        int *y = a + (rows - 1 - i) * ld;
+        for (size_t j = 0; j < cols; j += ARRAY_SIZE(tmp)) {
+            size_t k = MIN(cols - j, ARRAY_SIZE(tmp));
+            memcpy(tmp, x + j, sizeof(int) * k);
+            memcpy(x + j, y + j, sizeof(int) * k);
+            memcpy(y + j, tmp, sizeof(int) * k);
+        }
+    }
+}
+
+void matrix_rotate(int *a, size_t n, size_t ld)
+{
+    /* upside down then transposed, the flip streams whole rows */
+    matrix_flip_rows(a, n, n, ld);
+    matrix_transpose(a, n, ld);
+}
+
+/* ---- set zeroes ---- */
+
+static bool row_has_zero(const int *row, size_t cols)
+{
+    bool zero = false;
+
+    for (size_t j = 0; j < cols; j++) {
+        zero |= row[j] == 0;
+    }
+    return zero;
+}
+
+void matrix_set_zeroes(int *a, size_t rows, size_t cols, size_t ld)
+{
+    size_t m = 0;
+
+    while (m < rows && !row_has_zero(a + m * ld, cols)) {
+        m++;
+    }
+    if (m == rows) {
+        return;
+    }
+
+    /* row m is zeroed in the end anyway, so it holds a 0 for every column
+       with a 0, rows above it have none */
+    int *mark = a + m * ld;
+    for (size_t i = m + 1; i < rows; i++) {
+        int *row = a + i * ld;
+        bool zero = false;
+        for (size_t j = 0; j < cols; j++) {
+            zero |= row[j] == 0;
+            mark[j] &= -(row[j] != 0);
+        }
+        if (zero) {
+            memset(row, 0, sizeof(int) * cols);
+        }
+    }
+
+    /* the marks become and masks, so the columns are cleared a row at a
+       time instead of a column at a time */
+    for (size_t j = 0; j < cols; j++) {
+        mark[j] = -(mark[j] != 0);
+    }
+    for (size_t i = 0; i < rows; i++) {
+        if (i == m) {
+            continue;
+        }
+        int *row = a + i * ld;
+        for (size_t j = 0; j < cols; j++) {
+            row[j] &= mark[j];
+        }
+    }
+    memset(mark, 0, sizeof(int) * cols);
+}
+
+/* ---- diagonal order ---- */
+
+/* 0 + 1 + .. + (x - 1) + x, halved before the multiply so it only wraps
+   when the result does */
+static size_t triangle(size_t x)
+{
+    return x % 2 ? x * ((x + 1) / 2) : (x / 2) * (x + 1);
+}
+
+/* elements on the anti-diagonals before d */
+static size_t diag_start(size_t d, size_t rows, size_t cols)
+{
+    size_t s = d <= rows ? triangle(d) : triangle(rows) + (d - rows) * rows;
+
+    if (d > cols) {
+        s -= triangle(d - cols);
+    }
+    return s;
+}
+
+size_t matrix_diagonal_order(const int *a, size_t rows, size_t cols, size_t ld,
+                             int *out)
+{
+    /* each tile fills its piece of every anti-diagonal crossing it, the
+       pieces are runs in out */
+    for (size_t r0 = 0; r0 < rows; r0 += MATRIX_DIAG_TILE) {
+        size_t r1 = MIN(rows, r0 + MATRIX_DIAG_TILE);
+        for (size_t c0 = 0; c0 < cols; c0 += MATRIX_DIAG_TILE) {
+            size_t c1 = MIN(cols, c0 + MATRIX_DIAG_TILE);
+            for (size_t d = r0 + c0; d <= r1 + c1 - 2; d++) {
+                size_t lo = d >= c1 - 1 + r0 ? d - (c1 - 1) : r0;
+                size_t hi = MIN(r1 - 1, d - c0);
+                size_t s = diag_start(d, rows, cols);
+                if (d % 2 == 0) {
+                    size_t top = MIN(d, rows - 1);
+                    for (size_t r = lo; r <= hi; r++) {
+                        out[s + top - r] = a[r * ld + d - r];
+                    }
+                } else {
+                    size_t first = d >= cols ? d - cols + 1 : 0;
+                    for (size_t r = lo; r <= hi; r++) {
+                        out[s + r - first] = a[r * ld + d - r];
+                    }
+                }
+            }
+        }
+    }
+    return rows * cols;
+}
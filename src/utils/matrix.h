@@ -0,0 +1,114 @@
+/**
+ * @file matrix.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief in place transforms of row-major int matrices, transpose and
+ * rotate by recursive halving down to cache sized tiles with an AVX2 8x8
+ * kernel, set zeroes with a marker row, blocked diagonal traversal
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _MATRIX_H_
+#define _MATRIX_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* halving stops once both sides of a block are at most this */
+#define MATRIX_LEAF 32
+
+/* an "int **" matrix seen as one row-major block, packed into a copy
+   only when the rows are not evenly spaced */
+typedef struct {
+    int *data;
+    size_t rows;
+    size_t cols;
+    size_t ld; /* ints from one row to the next */
+    int **src; /* the rows data was packed from, NULL if in place */
+} matrix_view_t;
+
+/**
+ * @brief view rows as a block, in place if row i starts at rows[0] + i * ld
+ * for some ld >= cols, otherwise a packed copy
+ *
+ * @param v
+ * @param rows
+ * @param nrows
+ * @param cols
+ * @return int 0 on success, -1 on allocation failure
+ */
+int matrix_view_open(matrix_view_t *v, int **rows, size_t nrows, size_t cols);
+
+/**
+ * @brief end a view, a packed copy is written back to its rows if asked
+ * and freed
+ *
+ * @param v
+ * @param write_back
+ */
+void matrix_view_close(matrix_view_t *v, bool write_back);
+
+/**
+ * @brief transpose a square matrix in place
+ *
+ * @param a
+ * @param n
+ * @param ld
+ */
+void matrix_transpose(int *a, size_t n, size_t ld);
+
+/**
+ * @brief reverse the order of the rows, row i swaps with row rows - 1 - i
+ *
+ * @param a
+ * @param rows
+ * @param cols
+ * @param ld
+ */
+void matrix_flip_rows(int *a, size_t rows, size_t cols, size_t ld);
+
+/**
+ * @brief rotate a square matrix 90 degrees clockwise in place
+ *
+ * @param a
+ * @param n
+ * @param ld
+ */
+void matrix_rotate(int *a, size_t n, size_t ld);
+
+/**
+ * @brief zero every row and column that holds a 0, the first such row
+ * keeps the column marks so no extra memory is needed
+ *
+ * @param a
+ * @param rows
+ * @param cols
+ * @param ld
+ */
+void matrix_set_zeroes(int *a, size_t rows, size_t cols, size_t ld);
+
+/**
+ * @brief the elements in zigzag diagonal order, up and to the right on
+ * even anti-diagonals and down and to the left on odd ones
+ *
+ * @param a
+ * @param rows
+ * @param cols
+ * @param ld
+ * @param out rows * cols ints
+ * @return size_t ints written
+ */
+size_t matrix_diagonal_order(const int *a, size_t rows, size_t cols, size_t ld,
+                             int *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,223 @@
+/**
+ * @file merge.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "merge.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define MERGE_AVX2 1
+#endif
+
+void merge_backward(int *a, size_t m, const int *b, size_t n)
+{
+    size_t i = m, j = n, k = m + n;
+
+    /* once b is used up the rest of a is already in place */
+    while (j > 0) {
+        if (i > 0 && a[i - 1] > b[j - 1]) {
+            a[--k] = a[--i];
+        } else {
+            a[--k] = b[--j];
+        }
+    }
+}
+
+/* three sorted runs, the vector loop leaves its carry as the third */
+static void merge_scalar3(const int *a, size_t m, const int *b, size_t n,
+                          const int *c, size_t l, int *out)
+{
+    size_t i = 0, j = 0, h = 0;
+
+    while (i < m || j < n || h < l) {
+        int best = 0; /* 0 a, 1 b, 2 c */
+        int v = INT32_MAX;
+        if (i < m) {
+            v = a[i];
+        }
+        if (j < n && (i == m || b[j] < v)) {
+            v = b[j];
+            best = 1;
+        }
+        if (h < l && ((i == m && j == n) || c[h] < v)) {
+            v = c[h];
+            best = 2;
+        }
+        *out++ = v;
+        if (best == 0) {
+            i++;
+        } else if (best == 1) {
+            j++;
+        } else {
+            h++;
+        }
+    }
+}
+
+static void merge_scalar(const int *a, size_t m, const int *b, size_t n,
+                         int *out)
+{
+    size_t i = 0, j = 0;
+
+    while (i < m && j < n) {
+        int take_b = b[j] < a[i];
+        *out++ = take_b ? b[j] : a[i];
+        j += take_b;
+        i += !take_b;
+    }
+    memcpy(out, a + i, sizeof(int) * (m - i));
+    memcpy(out + (m - i), b + j, sizeof(int) * (n - j));
+}
+
+#if defined(MERGE_AVX2)
+/* sorts a bitonic sequence of 8, compare-exchange at distance 4, 2, 1 */
+__attribute__((target("avx2"))) static inline __m256i
+bitonic8(__m256i v)
+{
+    __m256i p = _mm256_permute2x128_si256(v, v, 1);
+    v = _mm256_blend_epi32(_mm256_min_epi32(v, p), _mm256_max_epi32(v, p),
+                           0xF0);
+    p = _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+    v = _mm256_blend_epi32(_mm256_min_epi32(v, p), _mm256_max_epi32(v, p),
+                           0xCC);
+    p = _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+    v = _mm256_blend_epi32(_mm256_min_epi32(v, p), _mm256_max_epi32(v, p),
+                           0xAA);
+    return v;
+}
+
+/* a and b sorted, lo gets the 8 smallest of both and hi the rest */
+__attribute__((target("avx2"))) static inline void
+merge16(__m256i a, __m256i b, __m256i *lo, __m256i *hi)
+{
+    const __m256i rev = _mm256_set_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    b = _mm256_permutevar8x32_epi32(b, rev);
+    *lo = bitonic8(_mm256_min_epi32(a, b));
+    *hi = bitonic8(_mm256_max_epi32(a, b));
+}
+
+/* every stored block is no larger than anything still unread, because
+   the next block comes from the run with the smaller head */
+__attribute__((target("avx2"))) static void
+merge_avx2(const int *a, size_t m, const int *b, size_t n, int *out)
+{
+    __m256i lo, hi;
+    size_t i = 8, j = 8;
+    int carry[8];
+
+    merge16(_mm256_loadu_si256((const __m256i *)a),
+            _mm256_loadu_si256((const __m256i *)b), &lo, &hi);
+    _mm256_storeu_si256((__m256i *)out, lo);
+    out += 8;
+    while (i + 8 <= m && j + 8 <= n) {
+        __m256i next;
+        if (a[i] <= b[j]) {
+            next = _mm256_loadu_si256((const __m256i *)(a + i));
+            i += 8;
+        } else {
+            next = _mm256_loadu_si256((const __m256i *)(b + j));
+            j += 8;
+        }
+        merge16(hi, next, &lo, &hi);
+        _mm256_storeu_si256((__m256i *)out, lo);
+        out += 8;
+    }
+    _mm256_storeu_si256((__m256i *)carry, hi);
+    merge_scalar3(a + i, m - i, b + j, n - j, carry, 8, out);
+}
+#endif
+
+void merge_two(const int *a, size_t m, const int *b, size_t n, int *out)
+{
+#if defined(MERGE_AVX2)
+    if (m >= 8 && n >= 8 && __builtin_cpu_supports("avx2")) {
+        merge_avx2(a, m, b, n, out);
+        return;
+    }
+#endif
+    merge_scalar(a, m, b, n, out);
+}
+
+/* node t holds the loser of its match, tree[0] the overall winner, leaf
+   of run s is node s + k, run k is a virtual minimum used while building */
+typedef struct {
+    int k;
+    int *tree;
+    int64_t *key; /* head of each run, INT64_MAX once it is used up */
+} loser_tree_t;
+
+/* the match outcome is data dependent, gcc keeps a branch for the ?:
+   form which then mispredicts half of the time, hence the xor swap */
+static void adjust(loser_tree_t *lt, int s)
+{
+    int *tree = lt->tree;
+    const int64_t *key = lt->key;
+
+    for (int t = (s + lt->k) / 2; t > 0; t /= 2) {
+        int w = tree[t];
+        int swap = (w ^ s) & -(int)(key[w] < key[s]);
+        tree[t] = w ^ swap;
+        s ^= swap;
+    }
+    tree[0] = s;
+}
+
+int merge_k(const int *const *runs, const size_t *lens, int k, int *out)
+{
+    if (k <= 0) {
+        return 0;
+    }
+    if (k == 1) {
+        memcpy(out, runs[0], sizeof(int) * lens[0]);
+        return 0;
+    }
+    if (k == 2) {
+        merge_two(runs[0], lens[0], runs[1], lens[1], out);
+        return 0;
+    }
+
+    loser_tree_t lt;
+    size_t *pos = (size_t *)calloc(k, sizeof(size_t));
+    lt.k = k;
+    lt.tree = (int *)malloc(sizeof(int) * k);
+    lt.key = (int64_t *)malloc(sizeof(int64_t) * (k + 1));
+    if (pos == NULL || lt.tree == NULL || lt.key == NULL) {
+        printf("Memory allocation failed.\n");
+        free(pos);
+        free(lt.tree);
+        free(lt.key);
+        return -1;
+    }
+    size_t total = 0;
+    for (int s = 0; s < k; s++) {
+        lt.key[s] = lens[s] > 0 ? runs[s][0] : INT64_MAX;
+        lt.tree[s] = k;
+        total += lens[s];
+    }
+    lt.key[k] = INT64_MIN;
+    for (int s = k - 1; s >= 0; s--) {
+        adjust(&lt, s);
+    }
+    for (size_t o = 0; o < total; o++) {
+        int s = lt.tree[0];
+        out[o] = (int)lt.key[s];
+        pos[s]++;
+        lt.key[s] = pos[s] < lens[s] ? runs[s][pos[s]] : INT64_MAX;
+        adjust(&lt, s);
+    }
+    free(pos);
+    free(lt.tree);
+    free(lt.key);
+    return 0;
+}
@@ -0,0 +1,61 @@
+/**
+ * @file merge.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief linear merges of sorted int runs, in place backward two-way
+ * merge, a two-way merge with an AVX2 bitonic kernel and k-way merge over
+ * a loser tree
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _MERGE_H_
+#define _MERGE_H_
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief merge b into a from the back, a holds m sorted ints followed by
+ * room for n more, O(m + n) and no scratch
+ *
+ * @param a
+ * @param m
+ * @param b sorted
+ * @param n
+ */
+void merge_backward(int *a, size_t m, const int *b, size_t n);
+
+/**
+ * @brief merge two sorted runs into out, 16 at a time through a bitonic
+ * network where AVX2 is available
+ *
+ * @param a sorted
+ * @param m
+ * @param b sorted
+ * @param n
+ * @param out m + n ints, not overlapping a or b
+ */
+void merge_two(const int *a, size_t m, const int *b, size_t n, int *out);
+
+/**
+ * @brief merge k sorted runs into out with a loser tree, O(total log k)
+ * and log k comparisons per element
+ *
+ * @param runs
+ * @param lens
+ * @param k
+ * @param out sum of lens ints
+ * @return int 0 on success, -1 on allocation failure
+ */
+int merge_k(const int *const *runs, const size_t *lens, int k, int *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
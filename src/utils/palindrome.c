@@ -0,0 +1,130 @@
+/**
+ * @file palindrome.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "utils.h"
+#include "palindrome.h"
+
+/* [l, r] is the rightmost palindrome found so far, a center inside it
+   starts from the radius of its mirror, so every byte is passed once */
+void palin_radii(const char *s, size_t n, size_t *odd, size_t *even)
+{
+    ptrdiff_t len = n;
+    ptrdiff_t l = 0, r = -1;
+
+    for (ptrdiff_t i = 0; i < len; i++) {
+        ptrdiff_t k = i > r ? 1 : MIN((ptrdiff_t)odd[l + r - i], r - i + 1);
+        while (i - k >= 0 && i + k < len && s[i - k] == s[i + k]) {
+            k++;
+        }
+        odd[i] = k--;
+        if (i + k > r) {
+            l = i - k;
+            r = i + k;
+        }
+    }
+    if (even == NULL) {
+        return;
+    }
+
+    l = 0;
+    r = -1;
+    for (ptrdiff_t i = 0; i < len; i++) {
+        ptrdiff_t k =
+            i > r ? 0 : MIN((ptrdiff_t)even[l + r - i + 1], r - i + 1);
+        while (i - k - 1 >= 0 && i + k < len && s[i - k - 1] == s[i + k]) {
+            k++;
+        }
+        even[i] = k--;
+        if (i + k > r) {
+            l = i - k - 1;
+            r = i + k;
+        }
+    }
+}
+
+int palin_longest(const char *s, size_t n, size_t *start, size_t *len)
+{
+    size_t *odd = (size_t *)malloc(sizeof(size_t) * (2 * n + 1));
+
+    if (odd == NULL) {
+        printf("Memory allocation failed.\n");
+        return -1;
+    }
+    size_t *even = odd + n;
+    palin_radii(s, n, odd, even);
+
+    *start = 0;
+    *len = 0;
+    for (size_t i = 0; i < n; i++) {
+        size_t lo = 2 * odd[i] - 1, le = 2 * even[i];
+        size_t so = i + 1 - odd[i], se = i - even[i];
+        /* equal lengths start further right at later centers, so strict
+           comparison keeps the leftmost */
+        if (lo > *len) {
+            *len = lo;
+            *start = so;
+        }
+        if (le > *len) {
+            *len = le;
+            *start = se;
+        }
+    }
+    free(odd);
+    return 0;
+}
+
+int palin_count(const char *s, size_t n, uint64_t *count)
+{
+    size_t *odd = (size_t *)malloc(sizeof(size_t) * (2 * n + 1));
+
+    if (odd == NULL) {
+        printf("Memory allocation failed.\n");
+        return -1;
+    }
+    size_t *even = odd + n;
+    palin_radii(s, n, odd, even);
+
+    /* a center with radius k holds k palindromes */
+    *count = 0;
+    for (size_t i = 0; i < n; i++) {
+        *count += odd[i] + even[i];
+    }
+    free(odd);
+    return 0;
+}
+
+static bool is_palindrome(const char *s, size_t l, size_t r)
+{
+    while (l < r) {
+        if (s[l++] != s[r--]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool palin_valid_delete_one(const char *s, size_t n)
+{
+    size_t l = 0, r = n;
+
+    if (n < 3) {
+        return true;
+    }
+    r--;
+    while (l < r && s[l] == s[r]) {
+        l++;
+        r--;
+    }
+    /* first mismatch, one of the two bytes has to go */
+    return l >= r || is_palindrome(s, l + 1, r) || is_palindrome(s, l, r - 1);
+}
@@ -0,0 +1,70 @@
+/**
+ * @file palindrome.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief palindromic substrings in linear time with Manacher's algorithm,
+ * and the one deletion palindrome check
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _PALINDROME_H_
+#define _PALINDROME_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief palindrome radii around every center, O(n)
+ *
+ * @param s
+ * @param n
+ * @param odd n entries, s[i - odd[i] + 1 .. i + odd[i] - 1] is the longest
+ * palindrome centered on s[i]
+ * @param even n entries, s[i - even[i] .. i + even[i] - 1] is the longest
+ * one centered between s[i - 1] and s[i], may be NULL
+ */
+void palin_radii(const char *s, size_t n, size_t *odd, size_t *even);
+
+/**
+ * @brief longest palindromic substring, the leftmost one on a tie
+ *
+ * @param s
+ * @param n
+ * @param start
+ * @param len 0 only for an empty s
+ * @return int 0 on success, -1 on allocation failure
+ */
+int palin_longest(const char *s, size_t n, size_t *start, size_t *len);
+
+/**
+ * @brief number of palindromic substrings, each position counted apart
+ *
+ * @param s
+ * @param n
+ * @param count
+ * @return int 0 on success, -1 on allocation failure
+ */
+int palin_count(const char *s, size_t n, uint64_t *count);
+
+/**
+ * @brief can s become a palindrome by deleting at most one byte, O(n)
+ *
+ * @param s
+ * @param n
+ * @return true
+ * @return false
+ */
+bool palin_valid_delete_one(const char *s, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
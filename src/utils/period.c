@@ -0,0 +1,105 @@
+/**
+ * @file period.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "period.h"
+
+void period_prefix(const char *s, size_t n, size_t *pi)
+{
+    if (n == 0) {
+        return;
+    }
+    pi[0] = 0;
+    for (size_t i = 1; i < n; i++) {
+        size_t k = pi[i - 1];
+        while (k > 0 && s[i] != s[k]) {
+            k = pi[k - 1];
+        }
+        pi[i] = k + (s[i] == s[k]);
+    }
+}
+
+void period_z(const char *s, size_t n, size_t *z)
+{
+    size_t l = 0, r = 0; /* rightmost match window s[l..r) */
+
+    if (n == 0) {
+        return;
+    }
+    z[0] = n;
+    for (size_t i = 1; i < n; i++) {
+        size_t k = 0;
+        if (i < r) {
+            k = z[i - l] < r - i ? z[i - l] : r - i;
+        }
+        while (i + k < n && s[k] == s[i + k]) {
+            k++;
+        }
+        z[i] = k;
+        if (i + k > r) {
+            l = i;
+            r = i + k;
+        }
+    }
+}
+
+size_t period_smallest(const char *s, size_t n)
+{
+    if (n == 0) {
+        return 0;
+    }
+    size_t *pi = (size_t *)malloc(sizeof(size_t) * n);
+    if (pi == NULL) {
+        printf("Memory allocation failed.\n");
+        return 0;
+    }
+    period_prefix(s, n, pi);
+    size_t p = n - pi[n - 1];
+    free(pi);
+    return p;
+}
+
+bool period_is_repetition(const char *s, size_t n)
+{
+    /* any period dividing n is a multiple of the smallest one */
+    size_t p = period_smallest(s, n);
+    return p > 0 && p < n && n % p == 0;
+}
+
+bool period_is_rotation(const char *a, size_t na, const char *b, size_t nb)
+{
+    if (na != nb) {
+        return false;
+    }
+    if (na == 0) {
+        return true;
+    }
+    size_t *pi = (size_t *)malloc(sizeof(size_t) * na);
+    if (pi == NULL) {
+        printf("Memory allocation failed.\n");
+        return false;
+    }
+    period_prefix(a, na, pi);
+    /* a match must start in b[0..n), so it ends before 2n - 1 */
+    size_t k = 0;
+    bool found = false;
+    for (size_t i = 0; i + 1 < 2 * nb && !found; i++) {
+        char c = b[i < nb ? i : i - nb];
+        while (k > 0 && c != a[k]) {
+            k = pi[k - 1];
+        }
+        k += c == a[k];
+        found = k == na;
+    }
+    free(pi);
+    return found;
+}
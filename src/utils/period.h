@@ -0,0 +1,79 @@
+/**
+ * @file period.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief string periodicity in linear time, KMP prefix function and Z
+ * function, smallest period, repetition and rotation tests
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _PERIOD_H_
+#define _PERIOD_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief border array, pi[i] is the length of the longest proper prefix
+ * of s[0..i] that is also its suffix, O(n)
+ *
+ * @param s
+ * @param n
+ * @param pi n entries
+ */
+void period_prefix(const char *s, size_t n, size_t *pi);
+
+/**
+ * @brief z[i] is the length of the longest common prefix of s and s[i..],
+ * z[0] = n, O(n)
+ *
+ * @param s
+ * @param n
+ * @param z n entries
+ */
+void period_z(const char *s, size_t n, size_t *z);
+
+/**
+ * @brief smallest p with s[i] == s[i + p] for all i, n - pi[n - 1]
+ *
+ * @param s
+ * @param n
+ * @return size_t n when s has no shorter period, 0 for an empty s or on
+ * allocation failure
+ */
+size_t period_smallest(const char *s, size_t n);
+
+/**
+ * @brief s is some shorter string repeated at least twice
+ *
+ * @param s
+ * @param n
+ * @return true
+ * @return false
+ */
+bool period_is_repetition(const char *s, size_t n);
+
+/**
+ * @brief b is a rotation of a, KMP of a over b read twice round, O(n)
+ * with no doubled copy
+ *
+ * @param a
+ * @param na
+ * @param b
+ * @param nb
+ * @return true
+ * @return false also on allocation failure
+ */
+bool period_is_rotation(const char *a, size_t na, const char *b, size_t nb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
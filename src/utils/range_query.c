@@ -0,0 +1,170 @@
+/**
+ * @file range_query.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "range_query.h"
+
+/* floor(log2(x)) for x >= 1 */
+static int log2_floor(unsigned int x)
+{
+    return 31 - __builtin_clz(x);
+}
+
+static int pick(rq_kind_t kind, int a, int b)
+{
+    if (kind == RQ_SPARSE_MIN) {
+        return a < b ? a : b;
+    }
+    return a > b ? a : b;
+}
+
+static void build_prefix(range_query_t *rq)
+{
+    rq->sums[0] = 0;
+    for (int i = 0; i < rq->n; i++) {
+        rq->sums[i + 1] = rq->sums[i] + rq->vals[i];
+    }
+}
+
+/* tree[i] holds the sum of the lowbit(i) elements ending at i, built in
+   O(n) by pushing every node into its parent once */
+static void build_fenwick(range_query_t *rq)
+{
+    int64_t *tree = rq->sums;
+
+    tree[0] = 0;
+    for (int i = 1; i <= rq->n; i++) {
+        tree[i] = rq->vals[i - 1];
+    }
+    for (int i = 1; i <= rq->n; i++) {
+        int parent = i + (i & -i);
+        if (parent <= rq->n) {
+            tree[parent] += tree[i];
+        }
+    }
+}
+
+/* every window touching vals[lo..hi], row k from row k - 1 */
+static void build_sparse_rows(range_query_t *rq, int lo, int hi)
+{
+    int n = rq->n;
+
+    memcpy(rq->sparse + lo, rq->vals + lo, sizeof(int) * (hi - lo + 1));
+    for (int k = 1; k < rq->levels; k++) {
+        const int *prev = rq->sparse + (size_t)(k - 1) * n;
+        int *row = rq->sparse + (size_t)k * n;
+        int half = 1 << (k - 1);
+        int from = MAX(lo - (1 << k) + 1, 0);
+        int to = MIN(hi, n - (1 << k));
+        for (int i = from; i <= to; i++) {
+            row[i] = pick(rq->kind, prev[i], prev[i + half]);
+        }
+    }
+}
+
+int rq_init(range_query_t *rq, rq_kind_t kind, const int *nums, int n)
+{
+    memset(rq, 0, sizeof(range_query_t));
+    rq->kind = kind;
+    rq->n = n;
+    rq->vals = (int *)malloc(sizeof(int) * MAX(n, 1));
+    if (rq->vals == NULL) {
+        printf("Memory allocation failed.\n");
+        return -1;
+    }
+    memcpy(rq->vals, nums, sizeof(int) * n);
+
+    if (kind == RQ_PREFIX_SUM || kind == RQ_FENWICK) {
+        rq->sums = (int64_t *)malloc(sizeof(int64_t) * (n + 1));
+        if (rq->sums == NULL) {
+            printf("Memory allocation failed.\n");
+            rq_destroy(rq);
+            return -1;
+        }
+        if (kind == RQ_PREFIX_SUM) {
+            build_prefix(rq);
+        } else {
+            build_fenwick(rq);
+        }
+        return 0;
+    }
+
+    rq->levels = n > 0 ? log2_floor(n) + 1 : 1;
+    rq->sparse = (int *)malloc(sizeof(int) * rq->levels * MAX(n, 1));
+    if (rq->sparse == NULL) {
+        printf("Memory allocation failed.\n");
+        rq_destroy(rq);
+        return -1;
+    }
+    build_sparse_rows(rq, 0, n - 1);
+    return 0;
+}
+
+void rq_destroy(range_query_t *rq)
+{
+    free(rq->vals);
+    free(rq->sums);
+    free(rq->sparse);
+    memset(rq, 0, sizeof(range_query_t));
+}
+
+static int64_t fenwick_prefix(const int64_t *tree, int i)
+{
+    int64_t sum = 0;
+
+    for (; i > 0; i -= i & -i) {
+        sum += tree[i];
+    }
+    return sum;
+}
+
+int64_t rq_query(const range_query_t *rq, int left, int right)
+{
+    switch (rq->kind) {
+    case RQ_PREFIX_SUM:
+        return rq->sums[right + 1] - rq->sums[left];
+    case RQ_FENWICK:
+        return fenwick_prefix(rq->sums, right + 1) -
+               fenwick_prefix(rq->sums, left);
+    default: {
+        /* two overlapping power of two windows cover the range */
+        int k = log2_floor(right - left + 1);
+        const int *row = rq->sparse + (size_t)k * rq->n;
+        return pick(rq->kind, row[left], row[right - (1 << k) + 1]);
+    }
+    }
+}
+
+void rq_update(range_query_t *rq, int index, int value)
+{
+    int64_t delta = (int64_t)value - rq->vals[index];
+
+    rq->vals[index] = value;
+    switch (rq->kind) {
+    case RQ_PREFIX_SUM:
+        for (int i = index + 1; i <= rq->n; i++) {
+            rq->sums[i] += delta;
+        }
+        break;
+    case RQ_FENWICK:
+        for (int i = index + 1; i <= rq->n; i += i & -i) {
+            rq->sums[i] += delta;
+        }
+        break;
+    default:
+        /* only windows containing index change */
+        build_sparse_rows(rq, index, index);
+        break;
+    }
+}
@@ -0,0 +1,80 @@
+/**
+ * @file range_query.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief range queries over an int array behind one API, prefix sums,
+ * Fenwick tree sums and sparse table min/max
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _RANGE_QUERY_H_
+#define _RANGE_QUERY_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    RQ_PREFIX_SUM, /* sum, O(1) query, O(n) update */
+    RQ_FENWICK, /* sum, O(log n) query and update */
+    RQ_SPARSE_MIN, /* min, O(1) query, O(n) update */
+    RQ_SPARSE_MAX, /* max, O(1) query, O(n) update */
+} rq_kind_t;
+
+typedef struct {
+    rq_kind_t kind;
+    int n;
+    int *vals; /* own copy of the input */
+    int64_t *sums; /* prefix sums or Fenwick tree, n + 1 entries */
+    int *sparse; /* levels rows of n, row k covers 2^k elements */
+    int levels;
+} range_query_t;
+
+/**
+ * @brief build over a copy of nums
+ *
+ * @param rq
+ * @param kind
+ * @param nums
+ * @param n
+ * @return int 0 on success, -1 on allocation failure
+ */
+int rq_init(range_query_t *rq, rq_kind_t kind, const int *nums, int n);
+
+/**
+ * @brief free the tables
+ *
+ * @param rq
+ */
+void rq_destroy(range_query_t *rq);
+
+/**
+ * @brief sum, min or max of nums[left..right]
+ *
+ * @param rq
+ * @param left
+ * @param right inclusive, left <= right < n
+ * @return int64_t
+ */
+int64_t rq_query(const range_query_t *rq, int left, int right);
+
+/**
+ * @brief nums[index] = value
+ *
+ * @param rq
+ * @param index
+ * @param value
+ */
+void rq_update(range_query_t *rq, int index, int value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
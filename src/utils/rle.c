@@ -0,0 +1,167 @@
+/**
+ * @file rle.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rle.h"
+
+size_t rle_say(const char *s, size_t len, char *out)
+{
+    size_t o = 0;
+
+    for (size_t i = 0; i < len;) {
+        size_t j = i + 1;
+        while (j < len && s[j] == s[i]) {
+            j++;
+        }
+        size_t cnt = j - i;
+        if (cnt < 10) {
+            out[o++] = (char)('0' + cnt);
+        } else {
+            char digits[20];
+            int d = 0;
+            for (; cnt > 0; cnt /= 10) {
+                digits[d++] = (char)('0' + cnt % 10);
+            }
+            while (d > 0) {
+                out[o++] = digits[--d];
+            }
+        }
+        out[o++] = s[i];
+        i = j;
+    }
+    return o;
+}
+
+char *rle_count_and_say(int n, size_t *len)
+{
+    /* terms grow by about 1.3 per step, never by more than 2 */
+    size_t cap = 64;
+    char *cur = (char *)malloc(cap);
+    char *next = (char *)malloc(cap);
+    size_t cur_len = 1;
+
+    if (cur == NULL || next == NULL) {
+        printf("Memory allocation failed.\n");
+        free(cur);
+        free(next);
+        return NULL;
+    }
+    cur[0] = '1';
+    for (int i = 1; i < n; i++) {
+        if (rle_say_bound(cur_len) + 1 > cap) {
+            cap = 2 * rle_say_bound(cur_len) + 1;
+            free(next);
+            next = (char *)malloc(cap);
+            char *grown = (char *)realloc(cur, cap);
+            if (next == NULL || grown == NULL) {
+                printf("Memory allocation failed.\n");
+                free(next);
+                free(grown != NULL ? grown : cur);
+                return NULL;
+            }
+            cur = grown;
+        }
+        cur_len = rle_say(cur, cur_len, next);
+        char *t = cur;
+        cur = next;
+        next = t;
+    }
+    free(next);
+    cur[cur_len] = '\0';
+    char *exact = (char *)realloc(cur, cur_len + 1);
+    if (len != NULL) {
+        *len = cur_len;
+    }
+    return exact != NULL ? exact : cur;
+}
+
+size_t rle_encode(const uint8_t *src, size_t n, uint8_t *dst)
+{
+    size_t o = 0;
+    size_t i = 0;
+
+    while (i < n) {
+        /* a repeat costs 2 bytes, so only runs of 3 or more pay off, a
+           pair stays inside the literals and the bound holds */
+        size_t run = 1;
+        while (i + run < n && run < 128 && src[i + run] == src[i]) {
+            run++;
+        }
+        if (run >= 3) {
+            dst[o++] = (uint8_t)(257 - run);
+            dst[o++] = src[i];
+            i += run;
+            continue;
+        }
+        size_t lit = 1;
+        while (i + lit < n && lit < 128 &&
+               !(i + lit + 2 < n && src[i + lit] == src[i + lit + 1] &&
+                 src[i + lit] == src[i + lit + 2])) {
+            lit++;
+        }
+        dst[o++] = (uint8_t)(lit - 1);
+        memcpy(dst + o, src + i, lit);
+        o += lit;
+        i += lit;
+    }
+    return o;
+}
+
+size_t rle_decoded_size(const uint8_t *src, size_t n)
+{
+    size_t out = 0;
+
+    for (size_t i = 0; i < n;) {
+        uint8_t h = src[i++];
+        if (h < 128) {
+            if (n - i < (size_t)h + 1) {
+                return RLE_ERROR;
+            }
+            out += h + 1;
+            i += h + 1;
+        } else if (h > 128) {
+            if (i == n) {
+                return RLE_ERROR;
+            }
+            out += 257 - h;
+            i++;
+        }
+    }
+    return out;
+}
+
+size_t rle_decode(const uint8_t *src, size_t n, uint8_t *dst, size_t cap)
+{
+    size_t o = 0;
+
+    for (size_t i = 0; i < n;) {
+        uint8_t h = src[i++];
+        if (h < 128) {
+            size_t lit = (size_t)h + 1;
+            if (n - i < lit || cap - o < lit) {
+                return RLE_ERROR;
+            }
+            memcpy(dst + o, src + i, lit);
+            o += lit;
+            i += lit;
+        } else if (h > 128) {
+            size_t run = 257 - (size_t)h;
+            if (i == n || cap - o < run) {
+                return RLE_ERROR;
+            }
+            memset(dst + o, src[i++], run);
+            o += run;
+        }
+    }
+    return o;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file rle.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief run-length coding, the look-and-say step behind countAndSay and a
+ * PackBits style codec for byte streams, both writing into buffers sized
+ * exactly or by a known bound
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _RLE_H_
+#define _RLE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RLE_ERROR ((size_t)-1)
+
+/**
+ * @brief say s, every run of a byte becomes its count in decimal followed
+ * by the byte, so the output is never more than twice as long
+ *
+ * @param s
+ * @param len
+ * @param out room for rle_say_bound(len) bytes
+ * @return size_t bytes written, no terminator
+ */
+size_t rle_say(const char *s, size_t len, char *out);
+
+/**
+ * @brief worst case output of rle_say, every byte a run of one
+ *
+ * @param len
+ * @return size_t
+ */
+static inline size_t rle_say_bound(size_t len)
+{
+    return 2 * len;
+}
+
+/**
+ * @brief term n of the look-and-say sequence starting from "1", built in
+ * two buffers that swap roles every step
+ *
+ * @param n >= 1
+ * @param len set to the length when not NULL
+ * @return char* malloced and NUL terminated, NULL on allocation failure
+ */
+char *rle_count_and_say(int n, size_t *len);
+
+/**
+ * @brief worst case size of rle_encode output
+ *
+ * @param n
+ * @return size_t
+ */
+static inline size_t rle_encode_bound(size_t n)
+{
+    return n + (n + 127) / 128;
+}
+
+/**
+ * @brief PackBits, header h < 128 is followed by h + 1 literal bytes,
+ * h > 128 by one byte repeated 257 - h times, runs of 3 and more are
+ * repeats
+ *
+ * @param src
+ * @param n
+ * @param dst room for rle_encode_bound(n) bytes
+ * @return size_t bytes written
+ */
+size_t rle_encode(const uint8_t *src, size_t n, uint8_t *dst);
+
+/**
+ * @brief size rle_decode will produce, for an exact output allocation
+ *
+ * @param src
+ * @param n
+ * @return size_t RLE_ERROR on truncated input
+ */
+size_t rle_decoded_size(const uint8_t *src, size_t n);
+
+/**
+ * @brief undo rle_encode
+ *
+ * @param src
+ * @param n
+ * @param dst
+ * @param cap bytes available at dst
+ * @return size_t bytes written, RLE_ERROR on truncated input or when cap
+ * is too small
+ */
+size_t rle_decode(const uint8_t *src, size_t n, uint8_t *dst, size_t cap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,573 @@
+/**
+ * @file scan.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "utils.h"
+#include "scan.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SCAN_AVX2 1
+#endif
+
+/* far enough from the ends that a sum or difference of two never wraps */
+#define SCAN_INF (INT64_MAX / 4)
+
+/* a segment as seen by maximum subarray, best sums of its nonempty
+   prefixes, suffixes and subarrays */
+typedef struct {
+    int64_t sum;
+    int64_t pre;
+    int64_t suf;
+    int64_t best;
+} kadane_t;
+
+/* a segment as seen by maximum gain */
+typedef struct {
+    int64_t min;
+    int64_t max;
+    int64_t best;
+} gain_t;
+
+static const kadane_t kadane_empty = {0, -SCAN_INF, -SCAN_INF, -SCAN_INF};
+static const gain_t gain_empty = {SCAN_INF, -SCAN_INF, 0};
+
+static kadane_t kadane_join(kadane_t a, kadane_t b)
+{
+    kadane_t r;
+
+    r.sum = a.sum + b.sum;
+    r.pre = MAX(a.pre, a.sum + b.pre);
+    r.suf = MAX(b.suf, b.sum + a.suf);
+    r.best = MAX(MAX(a.best, b.best), a.suf + b.pre);
+    return r;
+}
+
+static gain_t gain_join(gain_t a, gain_t b)
+{
+    gain_t r;
+
+    r.min = MIN(a.min, b.min);
+    r.max = MAX(a.max, b.max);
+    r.best = MAX(MAX(a.best, b.best), b.max - a.min);
+    return r;
+}
+
+static kadane_t kadane_scalar(const int *a, size_t n)
+{
+    kadane_t s = kadane_empty;
+    int64_t cur = 0; /* best sum ending here, 0 before the first */
+
+    for (size_t i = 0; i < n; i++) {
+        s.sum += a[i];
+        s.pre = MAX(s.pre, s.sum);
+        cur = MAX(cur, 0) + a[i];
+        s.best = MAX(s.best, cur);
+    }
+    if (n > 0) {
+        s.suf = cur;
+    }
+    return s;
+}
+
+static gain_t gain_scalar(const int *a, size_t n)
+{
+    gain_t s = gain_empty;
+
+    for (size_t i = 0; i < n; i++) {
+        s.min = MIN(s.min, a[i]);
+        s.max = MAX(s.max, a[i]);
+        s.best = MAX(s.best, a[i] - s.min);
+    }
+    return s;
+}
+
+static void prefix_scalar(const int *in, int *out, size_t n, unsigned carry)
+{
+    for (size_t i = 0; i < n; i++) {
+        carry += (unsigned)in[i];
+        out[i] = (int)carry;
+    }
+}
+
+static int64_t sum_scalar(const int *a, size_t n)
+{
+    int64_t s = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        s += a[i];
+    }
+    return s;
+}
+
+#if defined(SCAN_AVX2)
+__attribute__((target("avx2"))) static inline __m256i max64(__m256i a,
+                                                            __m256i b)
+{
+    return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(b, a));
+}
+
+__attribute__((target("avx2"))) static inline __m256i min64(__m256i a,
+                                                            __m256i b)
+{
+    return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b));
+}
+
+/* 4 ints from each of 4 segments, widened and transposed so column c
+   holds element k + c of every segment */
+__attribute__((target("avx2"))) static inline void
+load_columns(const int *const *seg, size_t k, __m256i col[4])
+{
+    __m256i r0 = _mm256_cvtepi32_epi64(
+        _mm_loadu_si128((const __m128i *)(seg[0] + k)));
+    __m256i r1 = _mm256_cvtepi32_epi64(
+        _mm_loadu_si128((const __m128i *)(seg[1] + k)));
+    __m256i r2 = _mm256_cvtepi32_epi64(
+        _mm_loadu_si128((const __m128i *)(seg[2] + k)));
+    __m256i r3 = _mm256_cvtepi32_epi64(
+        _mm_loadu_si128((const __m128i *)(seg[3] + k)));
+    __m256i t0 = _mm256_unpacklo_epi64(r0, r1);
+    __m256i t1 = _mm256_unpackhi_epi64(r0, r1);
+    __m256i t2 = _mm256_unpacklo_epi64(r2, r3);
+    __m256i t3 = _mm256_unpackhi_epi64(r2, r3);
+    col[0] = _mm256_permute2x128_si256(t0, t2, 0x20);
+    col[1] = _mm256_permute2x128_si256(t1, t3, 0x20);
+    col[2] = _mm256_permute2x128_si256(t0, t2, 0x31);
+    col[3] = _mm256_permute2x128_si256(t1, t3, 0x31);
+}
+
+/* four equal segments run Kadane side by side in 64-bit lanes, their
+   summaries and the scalar tail are joined in order */
+__attribute__((target("avx2"))) static kadane_t kadane_avx2(const int *a,
+                                                            size_t n)
+{
+    size_t len = n / 16 * 4;
+    const int *seg[4] = {a, a + len, a + 2 * len, a + 3 * len};
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i sum = zero, cur = zero;
+    __m256i pre = _mm256_set1_epi64x(-SCAN_INF), best = pre;
+    __m256i col[4];
+
+    for (size_t k = 0; k < len; k += 4) {
+        load_columns(seg, k, col);
+        for (int c = 0; c < 4; c++) {
+            sum = _mm256_add_epi64(sum, col[c]);
+            pre = max64(pre, sum);
+            cur = _mm256_andnot_si256(_mm256_cmpgt_epi64(zero, cur), cur);
+            cur = _mm256_add_epi64(cur, col[c]);
+            best = max64(best, cur);
+        }
+    }
+    int64_t lane[4][4];
+    _mm256_storeu_si256((__m256i *)lane[0], sum);
+    _mm256_storeu_si256((__m256i *)lane[1], pre);
+    _mm256_storeu_si256((__m256i *)lane[2], cur);
+    _mm256_storeu_si256((__m256i *)lane[3], best);
+    kadane_t s = kadane_empty;
+    for (int l = 0; l < 4; l++) {
+        kadane_t t = {lane[0][l], lane[1][l], lane[2][l], lane[3][l]};
+        s = kadane_join(s, t);
+    }
+    return kadane_join(s, kadane_scalar(a + 4 * len, n - 4 * len));
+}
+
+__attribute__((target("avx2"))) static gain_t gain_avx2(const int *a,
+                                                        size_t n)
+{
+    size_t len = n / 16 * 4;
+    const int *seg[4] = {a, a + len, a + 2 * len, a + 3 * len};
+    __m256i mn = _mm256_set1_epi64x(SCAN_INF);
+    __m256i mx = _mm256_set1_epi64x(-SCAN_INF);
+    __m256i best = _mm256_setzero_si256();
+    __m256i col[4];
+
+    for (size_t k = 0; k < len; k += 4) {
+        load_columns(seg, k, col);
+        for (int c = 0; c < 4; c++) {
+            mn = min64(mn, col[c]);
+            mx = max64(mx, col[c]);
+            best = max64(best, _mm256_sub_epi64(col[c], mn));
+        }
+    }
+    int64_t lane[3][4];
+    _mm256_storeu_si256((__m256i *)lane[0], mn);
+    _mm256_storeu_si256((__m256i *)lane[1], mx);
+    _mm256_storeu_si256((__m256i *)lane[2], best);
+    gain_t s = gain_empty;
+    for (int l = 0; l < 4; l++) {
+        gain_t t = {lane[0][l], lane[1][l], lane[2][l]};
+        s = gain_join(s, t);
+    }
+    return gain_join(s, gain_scalar(a + 4 * len, n - 4 * len));
+}
+
+/* 8 lane scan by shifts inside each 128-bit half, then the low half's
+   total into the high half, the carry chain is one add per 8 */
+__attribute__((target("avx2"))) static void
+prefix_avx2(const int *in, int *out, size_t n, unsigned carry)
+{
+    const __m256i last = _mm256_set1_epi32(7);
+    __m256i c = _mm256_set1_epi32((int)carry);
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(in + i));
+        x = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+        x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+        __m256i lo = _mm256_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+        x = _mm256_add_epi32(x, _mm256_permute2x128_si256(lo, lo, 0x08));
+        __m256i total = _mm256_permutevar8x32_epi32(x, last);
+        _mm256_storeu_si256((__m256i *)(out + i), _mm256_add_epi32(x, c));
+        c = _mm256_add_epi32(c, total);
+    }
+    carry = (unsigned)_mm256_cvtsi256_si32(c);
+    prefix_scalar(in + i, out + i, n - i, carry);
+}
+
+__attribute__((target("avx2"))) static int64_t sum_avx2(const int *a,
+                                                        size_t n)
+{
+    __m256i s0 = _mm256_setzero_si256(), s1 = s0;
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(a + i));
+        s0 = _mm256_add_epi64(
+            s0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(x)));
+        s1 = _mm256_add_epi64(
+            s1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(x, 1)));
+    }
+    int64_t lane[4];
+    _mm256_storeu_si256((__m256i *)lane, _mm256_add_epi64(s0, s1));
+    return lane[0] + lane[1] + lane[2] + lane[3] + sum_scalar(a + i, n - i);
+}
+
+/* 32 comparisons per mask, only masks mixing both kinds need a look
+   inside */
+__attribute__((target("avx2"))) static size_t
+longest_run_avx2(const int *a, size_t n, int v)
+{
+    const __m256i vv = _mm256_set1_epi32(v);
+    size_t best = 0, cur = 0, i = 0;
+
+    for (; i + 32 <= n; i += 32) {
+        uint32_t m = 0;
+        for (int b = 0; b < 4; b++) {
+            __m256i x = _mm256_loadu_si256((const __m256i *)(a + i + 8 * b));
+            __m256i eq = _mm256_cmpeq_epi32(x, vv);
+            m |= (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(eq))
+                 << (8 * b);
+        }
+        if (m == UINT32_MAX) {
+            cur += 32;
+            best = MAX(best, cur);
+            continue;
+        }
+        uint32_t zeros = ~m;
+        cur += __builtin_ctz(zeros);
+        best = MAX(best, cur);
+        if (__builtin_popcount(zeros) <= 4) {
+            /* few breaks, the runs are the gaps between them */
+            int prev = __builtin_ctz(zeros);
+            for (zeros &= zeros - 1; zeros != 0; zeros &= zeros - 1) {
+                int at = __builtin_ctz(zeros);
+                best = MAX(best, (size_t)(at - prev - 1));
+                prev = at;
+            }
+        } else {
+            /* each round trims every run by one, so it stops after the
+               longest one */
+            size_t inner = 0;
+            for (uint32_t x = m; x != 0; x &= x << 1) {
+                inner++;
+            }
+            best = MAX(best, inner);
+        }
+        cur = __builtin_clz(~m);
+        best = MAX(best, cur);
+    }
+    for (; i < n; i++) {
+        cur = a[i] == v ? cur + 1 : 0;
+        best = MAX(best, cur);
+    }
+    return MAX(best, cur);
+}
+#endif
+
+static bool has_avx2(void)
+{
+#if defined(SCAN_AVX2)
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+static kadane_t kadane_run(const int *a, size_t n)
+{
+#if defined(SCAN_AVX2)
+    if (n >= 64 && has_avx2()) {
+        return kadane_avx2(a, n);
+    }
+#endif
+    return kadane_scalar(a, n);
+}
+
+static gain_t gain_run(const int *a, size_t n)
+{
+#if defined(SCAN_AVX2)
+    if (n >= 64 && has_avx2()) {
+        return gain_avx2(a, n);
+    }
+#endif
+    return gain_scalar(a, n);
+}
+
+static void prefix_run(const int *in, int *out, size_t n, unsigned carry)
+{
+#if defined(SCAN_AVX2)
+    if (n >= 8 && has_avx2()) {
+        prefix_avx2(in, out, n, carry);
+        return;
+    }
+#endif
+    prefix_scalar(in, out, n, carry);
+}
+
+static int64_t sum_run(const int *a, size_t n)
+{
+#if defined(SCAN_AVX2)
+    if (n >= 8 && has_avx2()) {
+        return sum_avx2(a, n);
+    }
+#endif
+    return sum_scalar(a, n);
+}
+
+/* ---- chunks over threads ---- */
+
+typedef struct chunk chunk_t;
+
+typedef void (*chunk_fn)(chunk_t *c);
+
+struct chunk {
+    chunk_fn fn;
+    const int *in;
+    int *out;
+    size_t lo;
+    size_t hi;
+    unsigned carry;
+    int64_t sum;
+    kadane_t kadane;
+    gain_t gain;
+};
+
+static void *chunk_main(void *arg)
+{
+    chunk_t *c = (chunk_t *)arg;
+    c->fn(c);
+    return NULL;
+}
+
+static int pick_threads(size_t n, int threads)
+{
+    if (threads <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = cpus > 0 ? (int)cpus : 1;
+    }
+    size_t most = n / SCAN_PARALLEL_MIN;
+    if ((size_t)threads > most) {
+        threads = (int)most;
+    }
+    return MAX(1, MIN(threads, SCAN_MAX_THREADS));
+}
+
+/* chunk t covers [n * t / threads, n * (t + 1) / threads), chunk 0 runs
+   on the caller, and so does any chunk whose thread fails to start */
+static void run_chunks(chunk_t *c, int threads, size_t n)
+{
+    pthread_t tids[SCAN_MAX_THREADS];
+    bool started[SCAN_MAX_THREADS] = {false};
+
+    for (int t = 0; t < threads; t++) {
+        c[t].lo = n * t / threads;
+        c[t].hi = n * (t + 1) / threads;
+    }
+    for (int t = 1; t < threads; t++) {
+        started[t] = pthread_create(&tids[t], NULL, chunk_main, &c[t]) == 0;
+    }
+    c[0].fn(&c[0]);
+    for (int t = 1; t < threads; t++) {
+        if (started[t]) {
+            pthread_join(tids[t], NULL);
+        } else {
+            c[t].fn(&c[t]);
+        }
+    }
+}
+
+static void chunk_sum(chunk_t *c)
+{
+    c->sum = sum_run(c->in + c->lo, c->hi - c->lo);
+}
+
+static void chunk_prefix(chunk_t *c)
+{
+    prefix_run(c->in + c->lo, c->out + c->lo, c->hi - c->lo, c->carry);
+}
+
+static void chunk_kadane(chunk_t *c)
+{
+    c->kadane = kadane_run(c->in + c->lo, c->hi - c->lo);
+}
+
+static void chunk_gain(chunk_t *c)
+{
+    c->gain = gain_run(c->in + c->lo, c->hi - c->lo);
+}
+
+static void chunks_init(chunk_t *c, int threads, chunk_fn fn, const int *in,
+                        int *out)
+{
+    for (int t = 0; t < threads; t++) {
+        c[t].fn = fn;
+        c[t].in = in;
+        c[t].out = out;
+        c[t].carry = 0;
+    }
+}
+
+/* ---- public ---- */
+
+void scan_prefix_sum(const int *in, int *out, size_t n, int threads)
+{
+    chunk_t c[SCAN_MAX_THREADS];
+
+    threads = pick_threads(n, threads);
+    if (threads == 1) {
+        prefix_run(in, out, n, 0);
+        return;
+    }
+    /* chunk totals first, read only, then each chunk scans from its
+       offset, so the array is written once */
+    chunks_init(c, threads, chunk_sum, in, out);
+    run_chunks(c, threads, n);
+    unsigned carry = 0;
+    for (int t = 0; t < threads; t++) {
+        c[t].fn = chunk_prefix;
+        c[t].carry = carry;
+        carry += (unsigned)c[t].sum;
+    }
+    run_chunks(c, threads, n);
+}
+
+int64_t scan_sum(const int *a, size_t n, int threads)
+{
+    chunk_t c[SCAN_MAX_THREADS];
+    int64_t s = 0;
+
+    threads = pick_threads(n, threads);
+    if (threads == 1) {
+        return sum_run(a, n);
+    }
+    chunks_init(c, threads, chunk_sum, a, NULL);
+    run_chunks(c, threads, n);
+    for (int t = 0; t < threads; t++) {
+        s += c[t].sum;
+    }
+    return s;
+}
+
+int64_t scan_max_subarray(const int *a, size_t n, int threads)
+{
+    chunk_t c[SCAN_MAX_THREADS];
+
+    threads = pick_threads(n, threads);
+    if (threads == 1) {
+        return kadane_run(a, n).best;
+    }
+    chunks_init(c, threads, chunk_kadane, a, NULL);
+    run_chunks(c, threads, n);
+    kadane_t s = kadane_empty;
+    for (int t = 0; t < threads; t++) {
+        s = kadane_join(s, c[t].kadane);
+    }
+    return s.best;
+}
+
+int64_t scan_max_gain(const int *a, size_t n, int threads)
+{
+    chunk_t c[SCAN_MAX_THREADS];
+
+    threads = pick_threads(n, threads);
+    if (threads == 1) {
+        return gain_run(a, n).best;
+    }
+    chunks_init(c, threads, chunk_gain, a, NULL);
+    run_chunks(c, threads, n);
+    gain_t s = gain_empty;
+    for (int t = 0; t < threads; t++) {
+        s = gain_join(s, c[t].gain);
+    }
+    return s.best;
+}
+
+int64_t scan_max_product(const int *a, size_t n)
+{
+    /* largest and smallest product ending here, a negative factor swaps
+       their roles */
+    int64_t hi = a[0], lo = a[0], best = a[0];
+
+    for (size_t i = 1; i < n; i++) {
+        int64_t x = a[i];
+        if (x < 0) {
+            SWAP(int64_t, &hi, &lo);
+        }
+        hi = MAX(x, hi * x);
+        lo = MIN(x, lo * x);
+        best = MAX(best, hi);
+    }
+    return best;
+}
+
+size_t scan_longest_run(const int *a, size_t n, int v)
+{
+#if defined(SCAN_AVX2)
+    if (n >= 32 && has_avx2()) {
+        return longest_run_avx2(a, n, v);
+    }
+#endif
+    size_t best = 0, cur = 0;
+    for (size_t i = 0; i < n; i++) {
+        cur = a[i] == v ? cur + 1 : 0;
+        best = MAX(best, cur);
+    }
+    return best;
+}
+
+ptrdiff_t scan_balance_index(const int *a, size_t n)
+{
+    /* the total is a reduction, the search stops at the first hit so
+       it stays scalar */
+    int64_t total = sum_run(a, n);
+    int64_t left = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        if (left * 2 + a[i] == total) {
+            return (ptrdiff_t)i;
+        }
+        left += a[i];
+    }
+    return -1;
+}
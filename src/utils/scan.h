@@ -0,0 +1,102 @@
+/**
+ * @file scan.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief single pass scans and reductions over int arrays, prefix sums,
+ * maximum subarray and maximum gain as associative segment summaries, so
+ * AVX2 lanes and threads each take a segment and the results are folded
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _SCAN_H_
+#define _SCAN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* below this many elements per thread a scan stays on the caller */
+#define SCAN_PARALLEL_MIN (1 << 20)
+
+#define SCAN_MAX_THREADS 64
+
+/**
+ * @brief inclusive prefix sum, out[i] = in[0] + .. + in[i] wrapping like
+ * unsigned int, in and out may be the same array
+ *
+ * @param in
+ * @param out n ints
+ * @param n
+ * @param threads 0 for one per online CPU, at most SCAN_MAX_THREADS
+ */
+void scan_prefix_sum(const int *in, int *out, size_t n, int threads);
+
+/**
+ * @brief sum of all elements, exact in 64 bits
+ *
+ * @param a
+ * @param n
+ * @param threads 0 for one per online CPU, at most SCAN_MAX_THREADS
+ * @return int64_t
+ */
+int64_t scan_sum(const int *a, size_t n, int threads);
+
+/**
+ * @brief largest sum of a nonempty contiguous subarray, exact in 64 bits
+ *
+ * @param a
+ * @param n at least 1
+ * @param threads 0 for one per online CPU, at most SCAN_MAX_THREADS
+ * @return int64_t
+ */
+int64_t scan_max_subarray(const int *a, size_t n, int threads);
+
+/**
+ * @brief largest a[j] - a[i] with i <= j, so never below 0
+ *
+ * @param a
+ * @param n
+ * @param threads 0 for one per online CPU, at most SCAN_MAX_THREADS
+ * @return int64_t
+ */
+int64_t scan_max_gain(const int *a, size_t n, int threads);
+
+/**
+ * @brief largest product of a nonempty contiguous subarray, the products
+ * must fit in 64 bits
+ *
+ * @param a
+ * @param n at least 1
+ * @return int64_t
+ */
+int64_t scan_max_product(const int *a, size_t n);
+
+/**
+ * @brief length of the longest run of elements equal to v
+ *
+ * @param a
+ * @param n
+ * @param v
+ * @return size_t
+ */
+size_t scan_longest_run(const int *a, size_t n, int v);
+
+/**
+ * @brief first i where the sum before i equals the sum after it
+ *
+ * @param a
+ * @param n
+ * @return ptrdiff_t the index, -1 if there is none
+ */
+ptrdiff_t scan_balance_index(const int *a, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,396 @@
+/**
+ * @file skiplist.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+
+#include "skiplist.h"
+
+/* free erased nodes in batches, each batch waits for old readers once */
+#define SKIPLIST_RECLAIM_BATCH 64
+
+#define LOAD_ACQ(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define STORE_REL(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define LOAD_RLX(p) __atomic_load_n((p), __ATOMIC_RELAXED)
+#define STORE_RLX(p, v) __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+
+static int key_cmp(const skiplist_t *sl, const skiplist_key_t *a,
+                   const skiplist_key_t *b)
+{
+    if (sl->type == SKIPLIST_KEY_STR) {
+        return strcmp(a->s, b->s);
+    }
+    return (a->i > b->i) - (a->i < b->i);
+}
+
+/* p = 1/4, the expected height is 1.33 links per node */
+static int random_level(skiplist_t *sl)
+{
+    int level = 1;
+    unsigned int x = sl->seed;
+
+    for (;;) {
+        /* xorshift32 */
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        if ((x & 3) != 0 || level == SKIPLIST_MAX_LEVEL) {
+            break;
+        }
+        level++;
+    }
+    sl->seed = x;
+    return level;
+}
+
+static skiplist_node_t *node_create(int level)
+{
+    skiplist_node_t *node = (skiplist_node_t *)malloc(
+        sizeof(skiplist_node_t) + sizeof(skiplist_level_t) * level);
+    if (node == NULL) {
+        printf("Memory allocation failed.\n");
+        return NULL;
+    }
+    memset(node, 0,
+           sizeof(skiplist_node_t) + sizeof(skiplist_level_t) * level);
+    node->level = level;
+    return node;
+}
+
+static void node_free(const skiplist_t *sl, skiplist_node_t *node)
+{
+    if (sl->type == SKIPLIST_KEY_STR) {
+        free(node->key.s);
+    }
+    free(node);
+}
+
+skiplist_t *skiplist_create(skiplist_key_type_t type)
+{
+    skiplist_t *sl = (skiplist_t *)malloc(sizeof(skiplist_t));
+    if (sl == NULL) {
+        printf("Memory allocation failed.\n");
+        return NULL;
+    }
+    memset(sl, 0, sizeof(skiplist_t));
+    sl->type = type;
+    sl->level = 1;
+    sl->seed = 0x9E3779B9u;
+    sl->header = node_create(SKIPLIST_MAX_LEVEL);
+    if (sl->header == NULL) {
+        free(sl);
+        return NULL;
+    }
+    return sl;
+}
+
+void skiplist_destroy(skiplist_t *sl)
+{
+    if (sl == NULL) {
+        return;
+    }
+
+    skiplist_node_t *node = sl->header->levels[0].next;
+    while (node != NULL) {
+        skiplist_node_t *next = node->levels[0].next;
+        node_free(sl, node);
+        node = next;
+    }
+    while (sl->retired != NULL) {
+        node = sl->retired;
+        sl->retired = node->retire_next;
+        node_free(sl, node);
+    }
+    free(sl->header);
+    free(sl);
+}
+
+unsigned int skiplist_reader_enter(skiplist_t *sl)
+{
+    unsigned int token = LOAD_ACQ(&sl->epoch) & 1;
+
+    __atomic_fetch_add(&sl->readers[token], 1, __ATOMIC_RELAXED);
+    /* pairs with the fence in skiplist_reclaim: either the writer sees
+       this reader, or this reader sees the list after the unlink */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    return token;
+}
+
+void skiplist_reader_exit(skiplist_t *sl, unsigned int token)
+{
+    __atomic_fetch_sub(&sl->readers[token & 1], 1, __ATOMIC_RELEASE);
+}
+
+void skiplist_reclaim(skiplist_t *sl)
+{
+    if (sl->retired == NULL) {
+        return;
+    }
+
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    /* new readers go to the other counter, then wait for both parities
+       to drain once so nobody who saw a retired node is still inside */
+    for (int round = 0; round < 2; round++) {
+        unsigned long old = __atomic_fetch_add(&sl->epoch, 1, __ATOMIC_SEQ_CST);
+        while (LOAD_ACQ(&sl->readers[old & 1]) != 0) {
+            sched_yield();
+        }
+    }
+
+    while (sl->retired != NULL) {
+        skiplist_node_t *node = sl->retired;
+        sl->retired = node->retire_next;
+        node_free(sl, node);
+    }
+    sl->retired_cnt = 0;
+}
+
+/* fill update[] with the last node before key on every level and rank[]
+   with the position of update[i] */
+static skiplist_node_t *find_update(skiplist_t *sl, const skiplist_key_t *key,
+                                    skiplist_node_t **update, size_t *rank)
+{
+    skiplist_node_t *x = sl->header;
+
+    for (int i = sl->level - 1; i >= 0; i--) {
+        rank[i] = (i == sl->level - 1) ? 0 : rank[i + 1];
+        while (x->levels[i].next != NULL &&
+               key_cmp(sl, &x->levels[i].next->key, key) < 0) {
+            rank[i] += x->levels[i].span;
+            x = x->levels[i].next;
+        }
+        update[i] = x;
+    }
+    return x->levels[0].next;
+}
+
+static int skiplist_insert(skiplist_t *sl, const skiplist_key_t *key,
+                           void *value)
+{
+    skiplist_node_t *update[SKIPLIST_MAX_LEVEL];
+    size_t rank[SKIPLIST_MAX_LEVEL];
+    skiplist_node_t *x = find_update(sl, key, update, rank);
+
+    if (x != NULL && key_cmp(sl, &x->key, key) == 0) {
+        STORE_REL(&x->value, value);
+        return 0;
+    }
+
+    int level = random_level(sl);
+    if (level > sl->level) {
+        for (int i = sl->level; i < level; i++) {
+            rank[i] = 0;
+            update[i] = sl->header;
+            STORE_RLX(&sl->header->levels[i].span, sl->size);
+        }
+    }
+
+    x = node_create(level);
+    if (x == NULL) {
+        return -1;
+    }
+    if (sl->type == SKIPLIST_KEY_STR) {
+        x->key.s = strdup(key->s);
+        if (x->key.s == NULL) {
+            free(x);
+            return -1;
+        }
+    } else {
+        x->key.i = key->i;
+    }
+    x->value = value;
+
+    /* the node is private until linked, then publish bottom-up so a
+       reader that finds it on level i can always descend below i */
+    for (int i = 0; i < level; i++) {
+        x->levels[i].next = update[i]->levels[i].next;
+        x->levels[i].span = update[i]->levels[i].span - (rank[0] - rank[i]);
+        STORE_RLX(&update[i]->levels[i].span, (rank[0] - rank[i]) + 1);
+        STORE_REL(&update[i]->levels[i].next, x);
+    }
+    for (int i = level; i < sl->level; i++) {
+        STORE_RLX(&update[i]->levels[i].span, update[i]->levels[i].span + 1);
+    }
+    if (level > sl->level) {
+        STORE_REL(&sl->level, level);
+    }
+    STORE_RLX(&sl->size, sl->size + 1);
+    return 1;
+}
+
+static bool skiplist_erase(skiplist_t *sl, const skiplist_key_t *key)
+{
+    skiplist_node_t *update[SKIPLIST_MAX_LEVEL];
+    size_t rank[SKIPLIST_MAX_LEVEL];
+    skiplist_node_t *x = find_update(sl, key, update, rank);
+
+    if (x == NULL || key_cmp(sl, &x->key, key) != 0) {
+        return false;
+    }
+
+    /* unlink top-down, x keeps its own links for readers standing on it */
+    for (int i = sl->level - 1; i >= 0; i--) {
+        if (update[i]->levels[i].next == x) {
+            STORE_RLX(&update[i]->levels[i].span,
+                      update[i]->levels[i].span + x->levels[i].span - 1);
+            STORE_REL(&update[i]->levels[i].next, x->levels[i].next);
+        } else {
+            STORE_RLX(&update[i]->levels[i].span,
+                      update[i]->levels[i].span - 1);
+        }
+    }
+    int level = sl->level;
+    while (level > 1 && sl->header->levels[level - 1].next == NULL) {
+        level--;
+    }
+    STORE_REL(&sl->level, level);
+    STORE_RLX(&sl->size, sl->size - 1);
+
+    x->retire_next = sl->retired;
+    sl->retired = x;
+    if (++sl->retired_cnt >= SKIPLIST_RECLAIM_BATCH) {
+        skiplist_reclaim(sl);
+    }
+    return true;
+}
+
+int skiplist_insert_int(skiplist_t *sl, int key, void *value)
+{
+    skiplist_key_t k;
+    k.i = key;
+    return skiplist_insert(sl, &k, value);
+}
+
+int skiplist_insert_str(skiplist_t *sl, const char *key, void *value)
+{
+    skiplist_key_t k;
+    k.s = (char *)key;
+    return skiplist_insert(sl, &k, value);
+}
+
+bool skiplist_erase_int(skiplist_t *sl, int key)
+{
+    skiplist_key_t k;
+    k.i = key;
+    return skiplist_erase(sl, &k);
+}
+
+bool skiplist_erase_str(skiplist_t *sl, const char *key)
+{
+    skiplist_key_t k;
+    k.s = (char *)key;
+    return skiplist_erase(sl, &k);
+}
+
+/* reader side: only acquire loads, never writes shared state */
+static skiplist_node_t *lower_bound(skiplist_t *sl, const skiplist_key_t *key,
+                                    size_t *rank)
+{
+    skiplist_node_t *x = sl->header;
+    skiplist_node_t *next = NULL;
+    size_t traversed = 0;
+
+    for (int i = LOAD_ACQ(&sl->level) - 1; i >= 0; i--) {
+        while ((next = LOAD_ACQ(&x->levels[i].next)) != NULL &&
+               key_cmp(sl, &next->key, key) < 0) {
+            traversed += LOAD_RLX(&x->levels[i].span);
+            x = next;
+        }
+    }
+    if (rank != NULL) {
+        *rank = traversed + 1;
+    }
+    /* the level 0 link that stopped the walk, reloading it could return
+       a smaller key inserted meanwhile */
+    return next;
+}
+
+skiplist_node_t *skiplist_lower_bound_int(skiplist_t *sl, int key)
+{
+    skiplist_key_t k;
+    k.i = key;
+    return lower_bound(sl, &k, NULL);
+}
+
+skiplist_node_t *skiplist_lower_bound_str(skiplist_t *sl, const char *key)
+{
+    skiplist_key_t k;
+    k.s = (char *)key;
+    return lower_bound(sl, &k, NULL);
+}
+
+skiplist_node_t *skiplist_find_int(skiplist_t *sl, int key)
+{
+    skiplist_node_t *x = skiplist_lower_bound_int(sl, key);
+    return (x != NULL && x->key.i == key) ? x : NULL;
+}
+
+skiplist_node_t *skiplist_find_str(skiplist_t *sl, const char *key)
+{
+    skiplist_node_t *x = skiplist_lower_bound_str(sl, key);
+    return (x != NULL && strcmp(x->key.s, key) == 0) ? x : NULL;
+}
+
+skiplist_node_t *skiplist_first(skiplist_t *sl)
+{
+    return LOAD_ACQ(&sl->header->levels[0].next);
+}
+
+skiplist_node_t *skiplist_next(const skiplist_node_t *node)
+{
+    return LOAD_ACQ(&node->levels[0].next);
+}
+
+size_t skiplist_rank_int(skiplist_t *sl, int key)
+{
+    skiplist_key_t k;
+    size_t rank;
+    k.i = key;
+    skiplist_node_t *x = lower_bound(sl, &k, &rank);
+    return (x != NULL && x->key.i == key) ? rank : 0;
+}
+
+size_t skiplist_rank_str(skiplist_t *sl, const char *key)
+{
+    skiplist_key_t k;
+    size_t rank;
+    k.s = (char *)key;
+    skiplist_node_t *x = lower_bound(sl, &k, &rank);
+    return (x != NULL && strcmp(x->key.s, key) == 0) ? rank : 0;
+}
+
+skiplist_node_t *skiplist_select(skiplist_t *sl, size_t rank)
+{
+    skiplist_node_t *x = sl->header;
+    skiplist_node_t *next;
+    size_t traversed = 0;
+
+    if (rank == 0) {
+        return NULL;
+    }
+    for (int i = LOAD_ACQ(&sl->level) - 1; i >= 0; i--) {
+        while ((next = LOAD_ACQ(&x->levels[i].next)) != NULL &&
+               traversed + LOAD_RLX(&x->levels[i].span) <= rank) {
+            traversed += LOAD_RLX(&x->levels[i].span);
+            x = next;
+        }
+        if (traversed == rank) {
+            return x;
+        }
+    }
+    return NULL;
+}
+
+size_t skiplist_size(skiplist_t *sl)
+{
+    return LOAD_RLX(&sl->size);
+}
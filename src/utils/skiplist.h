@@ -0,0 +1,198 @@
+/**
+ * @file skiplist.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief ordered set on a skip list, keyed on int or string, with span
+ * counters for rank/select and lock-free readers next to one writer
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _SKIPLIST_H_
+#define _SKIPLIST_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SKIPLIST_MAX_LEVEL 32
+
+typedef enum { SKIPLIST_KEY_INT, SKIPLIST_KEY_STR } skiplist_key_type_t;
+
+typedef union {
+    int i;
+    char *s; /* owned copy */
+} skiplist_key_t;
+
+struct skiplist_node;
+
+typedef struct {
+    struct skiplist_node *next;
+    size_t span; /* nodes skipped by next, used for rank */
+} skiplist_level_t;
+
+typedef struct skiplist_node {
+    skiplist_key_t key;
+    void *value;
+    struct skiplist_node *retire_next; /* deferred free chain */
+    int level;
+    skiplist_level_t levels[];
+} skiplist_node_t;
+
+typedef struct {
+    skiplist_key_type_t type;
+    skiplist_node_t *header;
+    int level;
+    size_t size;
+    unsigned int seed;
+    /* reader registration, two counters flipped by the writer */
+    unsigned long epoch;
+    unsigned long readers[2];
+    skiplist_node_t *retired;
+    int retired_cnt;
+} skiplist_t;
+
+/*
+    Concurrency:
+    - one writer thread calls insert/erase/destroy
+    - any number of reader threads call find/lower_bound/next/rank/select
+      between skiplist_reader_enter() and skiplist_reader_exit(), readers
+      never block and never block each other
+    - erased nodes are freed only after every reader that could still see
+      them has left, so node pointers stay valid until reader_exit
+    - rank/select are exact when no insert/erase runs at the same time,
+      while one does they may be off by the in-flight update
+*/
+
+/**
+ * @brief create an empty set
+ *
+ * @param type key type for the whole list
+ * @return skiplist_t* NULL on allocation failure
+ */
+skiplist_t *skiplist_create(skiplist_key_type_t type);
+
+/**
+ * @brief free the list, no reader may be inside
+ *
+ * @param sl
+ */
+void skiplist_destroy(skiplist_t *sl);
+
+/**
+ * @brief insert key or replace the value of an existing key (writer)
+ *
+ * @param sl
+ * @param key
+ * @param value
+ * @return int 1 inserted, 0 value replaced, -1 allocation failure
+ */
+int skiplist_insert_int(skiplist_t *sl, int key, void *value);
+int skiplist_insert_str(skiplist_t *sl, const char *key, void *value);
+
+/**
+ * @brief remove key (writer)
+ *
+ * @param sl
+ * @param key
+ * @return true removed
+ * @return false not found
+ */
+bool skiplist_erase_int(skiplist_t *sl, int key);
+bool skiplist_erase_str(skiplist_t *sl, const char *key);
+
+/**
+ * @brief free erased nodes once no reader can reach them (writer), done
+ * automatically every few erases
+ *
+ * @param sl
+ */
+void skiplist_reclaim(skiplist_t *sl);
+
+/**
+ * @brief register a reader, pass the return value to skiplist_reader_exit
+ *
+ * @param sl
+ * @return unsigned int
+ */
+unsigned int skiplist_reader_enter(skiplist_t *sl);
+void skiplist_reader_exit(skiplist_t *sl, unsigned int token);
+
+/**
+ * @brief exact match
+ *
+ * @param sl
+ * @param key
+ * @return skiplist_node_t* NULL if not found
+ */
+skiplist_node_t *skiplist_find_int(skiplist_t *sl, int key);
+skiplist_node_t *skiplist_find_str(skiplist_t *sl, const char *key);
+
+/**
+ * @brief first node with node key >= key, start of a range walk
+ *
+ * @param sl
+ * @param key
+ * @return skiplist_node_t* NULL if every key is smaller
+ */
+skiplist_node_t *skiplist_lower_bound_int(skiplist_t *sl, int key);
+skiplist_node_t *skiplist_lower_bound_str(skiplist_t *sl, const char *key);
+
+/**
+ * @brief smallest node, NULL if empty
+ *
+ * @param sl
+ * @return skiplist_node_t*
+ */
+skiplist_node_t *skiplist_first(skiplist_t *sl);
+
+/**
+ * @brief in-order successor, NULL at the end
+ *
+ * @param node
+ * @return skiplist_node_t*
+ */
+skiplist_node_t *skiplist_next(const skiplist_node_t *node);
+
+/* walk [lo, hi] in order, node is skiplist_node_t * */
+#define SKIPLIST_FOREACH_RANGE_INT(sl, node, lo, hi)                   \
+    for ((node) = skiplist_lower_bound_int((sl), (lo));                \
+         (node) != NULL && (node)->key.i <= (hi);                      \
+         (node) = skiplist_next(node))
+
+/**
+ * @brief 1-based position of key in sorted order
+ *
+ * @param sl
+ * @param key
+ * @return size_t 0 if not found
+ */
+size_t skiplist_rank_int(skiplist_t *sl, int key);
+size_t skiplist_rank_str(skiplist_t *sl, const char *key);
+
+/**
+ * @brief node at 1-based position rank
+ *
+ * @param sl
+ * @param rank 1 <= rank <= size
+ * @return skiplist_node_t* NULL if out of range
+ */
+skiplist_node_t *skiplist_select(skiplist_t *sl, size_t rank);
+
+/**
+ * @brief number of keys
+ *
+ * @param sl
+ * @return size_t
+ */
+size_t skiplist_size(skiplist_t *sl);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,116 @@
+/**
+ * @file sliding_window.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <string.h>
+
+#include "sliding_window.h"
+
+void sw_init(sw_window_t *w, int k)
+{
+    memset(w, 0, sizeof(sw_window_t));
+    w->k = k;
+    w->head = -1;
+    w->tail = -1;
+}
+
+static void list_unlink(sw_window_t *w, int c)
+{
+    if (w->prev[c] >= 0) {
+        w->next[w->prev[c]] = w->next[c];
+    } else {
+        w->head = w->next[c];
+    }
+    if (w->next[c] >= 0) {
+        w->prev[w->next[c]] = w->prev[c];
+    } else {
+        w->tail = w->prev[c];
+    }
+}
+
+static void list_append(sw_window_t *w, int c)
+{
+    w->prev[c] = w->tail;
+    w->next[c] = -1;
+    if (w->tail >= 0) {
+        w->next[w->tail] = c;
+    } else {
+        w->head = c;
+    }
+    w->tail = c;
+}
+
+/* a repeat moves the window start just past the previous occurrence */
+static void feed_no_repeat(sw_window_t *w, const uint8_t *p, size_t len)
+{
+    uint64_t pos = w->pos, start = w->start;
+    uint64_t best_len = w->best_len, best_start = w->best_start;
+
+    for (size_t i = 0; i < len; i++, pos++) {
+        uint64_t seen = w->last[p[i]];
+        start = seen > start ? seen : start;
+        w->last[p[i]] = pos + 1;
+        if (pos + 1 - start > best_len) {
+            best_len = pos + 1 - start;
+            best_start = start;
+        }
+    }
+    w->pos = pos;
+    w->start = start;
+    w->best_len = best_len;
+    w->best_start = best_start;
+}
+
+/* one byte too many evicts the one seen longest ago, the window then
+   starts just past its latest occurrence */
+static void feed_k(sw_window_t *w, const uint8_t *p, size_t len)
+{
+    /* locals, stores through the byte pointer could alias w */
+    uint64_t pos = w->pos, start = w->start;
+    uint64_t best_len = w->best_len, best_start = w->best_start;
+
+    for (size_t i = 0; i < len; i++, pos++) {
+        int c = p[i];
+        if (w->last[c] > start) {
+            list_unlink(w, c);
+        } else if (++w->distinct > w->k) {
+            int old = w->head;
+            list_unlink(w, old);
+            start = w->last[old];
+            w->distinct--;
+        }
+        list_append(w, c);
+        w->last[c] = pos + 1;
+        if (pos + 1 - start > best_len) {
+            best_len = pos + 1 - start;
+            best_start = start;
+        }
+    }
+    w->pos = pos;
+    w->start = start;
+    w->best_len = best_len;
+    w->best_start = best_start;
+}
+
+void sw_feed(sw_window_t *w, const void *buf, size_t len)
+{
+    if (w->k == SW_NO_REPEAT) {
+        feed_no_repeat(w, (const uint8_t *)buf, len);
+    } else {
+        feed_k(w, (const uint8_t *)buf, len);
+    }
+}
+
+uint64_t sw_best(const sw_window_t *w, uint64_t *start)
+{
+    if (start != NULL) {
+        *start = w->best_start;
+    }
+    return w->best_len;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file sliding_window.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief longest byte window without repeats or with at most k distinct
+ * bytes, fed incrementally so streams of any size take one pass
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _SLIDING_WINDOW_H_
+#define _SLIDING_WINDOW_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SW_NO_REPEAT 0 /* k for windows where every byte is unique */
+
+typedef struct {
+    int k;
+    int distinct;
+    uint64_t pos; /* bytes fed */
+    uint64_t start; /* window is [start, pos) */
+    uint64_t best_len;
+    uint64_t best_start;
+    uint64_t last[256]; /* 1 + position of the latest occurrence, 0 unseen */
+    /* k mode: window bytes by latest occurrence, the head goes first */
+    int16_t prev[256];
+    int16_t next[256];
+    int16_t head;
+    int16_t tail;
+} sw_window_t;
+
+/**
+ * @brief start an empty stream
+ *
+ * @param w
+ * @param k SW_NO_REPEAT, or the distinct byte limit 1..256
+ */
+void sw_init(sw_window_t *w, int k);
+
+/**
+ * @brief append bytes, O(1) each
+ *
+ * @param w
+ * @param buf
+ * @param len
+ */
+void sw_feed(sw_window_t *w, const void *buf, size_t len);
+
+/**
+ * @brief longest window seen so far, the earliest one on a tie
+ *
+ * @param w
+ * @param start stream offset of that window, may be NULL
+ * @return uint64_t its length
+ */
+uint64_t sw_best(const sw_window_t *w, uint64_t *start);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,350 @@
+/**
+ * @file str_search.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "utils.h"
+#include "str_search.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define STR_SEARCH_AVX2 1
+#endif
+
+typedef unsigned char uchar;
+
+/* verify work the filter may spend per scanned byte before handing the
+   rest to Two-Way, keeps the whole search linear */
+#define FILTER_WORK(pos, nlen) (2 * (pos) + 16 * (nlen) + 256)
+
+/* start of the maximal suffix of n, for the order given by rev, and its
+   period, see Crochemore and Perrin, Two-way string-matching */
+static ptrdiff_t max_suffix(const uchar *n, ptrdiff_t nn, ptrdiff_t *period,
+                            bool rev)
+{
+    ptrdiff_t ip = -1, jp = 0, k = 1, p = 1;
+
+    while (jp + k < nn) {
+        uchar a = n[ip + k], b = n[jp + k];
+        if (a == b) {
+            if (k == p) {
+                jp += p;
+                k = 1;
+            } else {
+                k++;
+            }
+        } else if (rev ? a < b : a > b) {
+            jp += k;
+            k = 1;
+            p = jp - ip;
+        } else {
+            ip = jp++;
+            k = p = 1;
+        }
+    }
+    *period = p;
+    return ip;
+}
+
+const char *str_search_two_way(const char *haystack, size_t hlen,
+                               const char *needle, size_t nlen)
+{
+    const uchar *h = (const uchar *)haystack;
+    const uchar *n = (const uchar *)needle;
+    ptrdiff_t hn = hlen, nn = nlen;
+    ptrdiff_t p, p2;
+
+    if (nn == 0) {
+        return haystack;
+    }
+    if (nn > hn) {
+        return NULL;
+    }
+
+    /* critical factorization n = n[0..ms] n[ms+1..] */
+    ptrdiff_t ms = max_suffix(n, nn, &p, false);
+    ptrdiff_t ms2 = max_suffix(n, nn, &p2, true);
+    if (ms2 > ms) {
+        ms = ms2;
+        p = p2;
+    }
+
+    /* periodic needles remember the matched prefix after a full shift */
+    ptrdiff_t mem0;
+    if (memcmp(n, n + p, ms + 1) == 0) {
+        mem0 = nn - p;
+    } else {
+        mem0 = 0;
+        p = MAX(ms, nn - ms - 1) + 1;
+    }
+
+    /* bad character shift on the last window byte, 1 + last index */
+    ptrdiff_t shift[256] = {0};
+    for (ptrdiff_t i = 0; i < nn; i++) {
+        shift[n[i]] = i + 1;
+    }
+
+    ptrdiff_t mem = 0;
+    for (ptrdiff_t j = 0; j + nn <= hn;) {
+        ptrdiff_t k = nn - shift[h[j + nn - 1]];
+        if (k > 0) {
+            j += MAX(k, mem);
+            mem = 0;
+            continue;
+        }
+
+        k = MAX(ms + 1, mem);
+        while (k < nn && n[k] == h[j + k]) {
+            k++;
+        }
+        if (k < nn) {
+            j += k - ms;
+            mem = 0;
+            continue;
+        }
+        for (k = ms + 1; k > mem && n[k - 1] == h[j + k - 1]; k--) {
+        }
+        if (k <= mem) {
+            return haystack + j;
+        }
+        j += p;
+        mem = mem0;
+    }
+    return NULL;
+}
+
+/* candidates are positions whose first and last byte match, found with
+   memchr, *stop < hlen when verification got too expensive there */
+static const char *filter_scalar(const uchar *h, size_t hn, const uchar *n,
+                                 size_t nn, size_t j, size_t *stop)
+{
+    size_t work = 0;
+
+    while (j + nn <= hn) {
+        const uchar *c = (const uchar *)memchr(h + j, n[0], hn - nn + 1 - j);
+        if (c == NULL) {
+            break;
+        }
+        j = c - h;
+        if (h[j + nn - 1] == n[nn - 1]) {
+            if (memcmp(h + j + 1, n + 1, nn - 2) == 0) {
+                return (const char *)h + j;
+            }
+            work += nn;
+            if (work > FILTER_WORK(j, nn)) {
+                *stop = j + 1;
+                return NULL;
+            }
+        }
+        j++;
+    }
+    *stop = hn;
+    return NULL;
+}
+
+#if defined(STR_SEARCH_AVX2)
+/* 32 candidate positions per step, compares the first needle byte at
+   h[j..] and the last one at h[j + nn - 1..] */
+__attribute__((target("avx2"))) static const char *
+filter_avx2(const uchar *h, size_t hn, const uchar *n, size_t nn,
+            size_t *stop)
+{
+    const __m256i first = _mm256_set1_epi8((char)n[0]);
+    const __m256i last = _mm256_set1_epi8((char)n[nn - 1]);
+    size_t work = 0;
+    size_t j = 0;
+
+    for (; j + nn - 1 + 32 <= hn; j += 32) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)(h + j));
+        __m256i b = _mm256_loadu_si256((const __m256i *)(h + j + nn - 1));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(
+            _mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last)));
+        while (mask != 0) {
+            int bit = __builtin_ctz(mask);
+            if (memcmp(h + j + bit + 1, n + 1, nn - 2) == 0) {
+                return (const char *)h + j + bit;
+            }
+            work += nn;
+            if (work > FILTER_WORK(j, nn)) {
+                *stop = j + bit + 1;
+                return NULL;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return filter_scalar(h, hn, n, nn, j, stop);
+}
+#endif
+
+const char *str_search(const char *haystack, size_t hlen, const char *needle,
+                       size_t nlen)
+{
+    const uchar *h = (const uchar *)haystack;
+    const uchar *n = (const uchar *)needle;
+    const char *found;
+    size_t stop;
+
+    if (nlen == 0) {
+        return haystack;
+    }
+    if (nlen > hlen) {
+        return NULL;
+    }
+    if (nlen == 1) {
+        return (const char *)memchr(haystack, n[0], hlen);
+    }
+
+#if defined(STR_SEARCH_AVX2)
+    if (__builtin_cpu_supports("avx2")) {
+        found = filter_avx2(h, hlen, n, nlen, &stop);
+    } else {
+        found = filter_scalar(h, hlen, n, nlen, 0, &stop);
+    }
+#else
+    found = filter_scalar(h, hlen, n, nlen, 0, &stop);
+#endif
+    if (found != NULL || stop >= hlen) {
+        return found;
+    }
+    /* adversarial input, nothing before stop matches */
+    return str_search_two_way(haystack + stop, hlen - stop, needle, nlen);
+}
+
+int str_multi_init(str_multi_t *sm, const char **needles, const size_t *lens,
+                   int count)
+{
+    if (count <= 0 || count > STR_MULTI_MAX) {
+        return -1;
+    }
+    memset(sm, 0, sizeof(str_multi_t));
+    sm->count = count;
+    for (int i = 0; i < count; i++) {
+        const uchar *n = (const uchar *)needles[i];
+        uint64_t bit = BIT64(i);
+        if (lens[i] == 0) {
+            return -1;
+        }
+        if (lens[i] == 1) {
+            /* any byte may follow, only the first one can be filtered */
+            sm->num_starts = STR_MULTI_STARTS + 1;
+        } else if (sm->num_starts <= STR_MULTI_STARTS) {
+            int s = 0;
+            while (s < sm->num_starts && (sm->starts[s][0] != n[0] ||
+                                          sm->starts[s][1] != n[1])) {
+                s++;
+            }
+            if (s == sm->num_starts) {
+                if (s < STR_MULTI_STARTS) {
+                    sm->starts[s][0] = n[0];
+                    sm->starts[s][1] = n[1];
+                }
+                sm->num_starts++;
+            }
+        }
+        sm->needles[i] = needles[i];
+        sm->lens[i] = lens[i];
+        sm->first[n[0]] |= bit;
+        if (lens[i] == 1) {
+            sm->single |= bit;
+            for (int c = 0; c < 256; c++) {
+                sm->second[c] |= bit;
+            }
+        } else {
+            sm->second[n[1]] |= bit;
+        }
+    }
+    return 0;
+}
+
+/* verify every needle that may start at h[j] */
+static const char *multi_verify(const str_multi_t *sm, const uchar *h,
+                                size_t hn, size_t j, int *which)
+{
+    uint64_t cand = sm->first[h[j]];
+
+    cand &= j + 1 < hn ? sm->second[h[j + 1]] : sm->single;
+    /* lowest bit first, so the earlier needle wins a tie */
+    while (cand != 0) {
+        int i = __builtin_ctzll(cand);
+        size_t len = sm->lens[i];
+        if (len <= hn - j && memcmp(h + j, sm->needles[i], len) == 0) {
+            if (which != NULL) {
+                *which = i;
+            }
+            return (const char *)h + j;
+        }
+        cand &= cand - 1;
+    }
+    return NULL;
+}
+
+#if defined(STR_SEARCH_AVX2)
+/* test 32 positions against every distinct 2 byte prefix at once */
+__attribute__((target("avx2"))) static const char *
+multi_avx2(const str_multi_t *sm, const uchar *h, size_t hn, size_t *stop,
+           int *which)
+{
+    __m256i b0[STR_MULTI_STARTS], b1[STR_MULTI_STARTS];
+    size_t j = 0;
+
+    for (int s = 0; s < sm->num_starts; s++) {
+        b0[s] = _mm256_set1_epi8((char)sm->starts[s][0]);
+        b1[s] = _mm256_set1_epi8((char)sm->starts[s][1]);
+    }
+    for (; j + 33 <= hn; j += 32) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)(h + j));
+        __m256i b = _mm256_loadu_si256((const __m256i *)(h + j + 1));
+        __m256i eq = _mm256_setzero_si256();
+        for (int s = 0; s < sm->num_starts; s++) {
+            eq = _mm256_or_si256(eq, _mm256_and_si256(
+                                         _mm256_cmpeq_epi8(a, b0[s]),
+                                         _mm256_cmpeq_epi8(b, b1[s])));
+        }
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(eq);
+        while (mask != 0) {
+            const char *found =
+                multi_verify(sm, h, hn, j + __builtin_ctz(mask), which);
+            if (found != NULL) {
+                return found;
+            }
+            mask &= mask - 1;
+        }
+    }
+    *stop = j;
+    return NULL;
+}
+#endif
+
+const char *str_multi_search(const str_multi_t *sm, const char *haystack,
+                             size_t hlen, int *which)
+{
+    const uchar *h = (const uchar *)haystack;
+    size_t j = 0;
+
+#if defined(STR_SEARCH_AVX2)
+    if (sm->num_starts <= STR_MULTI_STARTS &&
+        __builtin_cpu_supports("avx2")) {
+        const char *found = multi_avx2(sm, h, hlen, &j, which);
+        if (found != NULL) {
+            return found;
+        }
+    }
+#endif
+    for (; j < hlen; j++) {
+        if (sm->first[h[j]] != 0) {
+            const char *found = multi_verify(sm, h, hlen, j, which);
+            if (found != NULL) {
+                return found;
+            }
+        }
+    }
+    return NULL;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file str_search.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief substring search, Two-Way for linear worst case with an AVX2
+ * first/last byte filter for the common case, plus a multi-needle scan
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _STR_SEARCH_H_
+#define _STR_SEARCH_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STR_MULTI_MAX 64
+#define STR_MULTI_STARTS 8 /* distinct 2 byte prefixes the AVX2 scan takes */
+
+typedef struct {
+    int count;
+    const char *needles[STR_MULTI_MAX];
+    size_t lens[STR_MULTI_MAX];
+    /* bit i set when needle i can start here, a position is a candidate
+       only if first[h[0]] & second[h[1]] has a bit, then it is verified */
+    uint64_t first[256];
+    uint64_t second[256]; /* all ones for needles of length 1 */
+    uint64_t single; /* needles of length 1 */
+    int num_starts; /* distinct prefixes, > STR_MULTI_STARTS is scalar */
+    uint8_t starts[STR_MULTI_STARTS][2];
+} str_multi_t;
+
+/**
+ * @brief first occurrence of needle in haystack, neither needs a NUL
+ *
+ * @param haystack
+ * @param hlen
+ * @param needle
+ * @param nlen 0 matches at haystack
+ * @return const char* NULL if not found
+ */
+const char *str_search(const char *haystack, size_t hlen, const char *needle,
+                       size_t nlen);
+
+/**
+ * @brief Two-Way only, O(hlen + nlen) time and O(1) space on any input
+ *
+ * @param haystack
+ * @param hlen
+ * @param needle
+ * @param nlen
+ * @return const char* NULL if not found
+ */
+const char *str_search_two_way(const char *haystack, size_t hlen,
+                               const char *needle, size_t nlen);
+
+/**
+ * @brief prepare a set of needles, the strings are referenced not copied
+ *
+ * @param sm
+ * @param needles
+ * @param lens
+ * @param count 1..STR_MULTI_MAX, every length >= 1
+ * @return int 0 on success, -1 on bad input
+ */
+int str_multi_init(str_multi_t *sm, const char **needles, const size_t *lens,
+                   int count);
+
+/**
+ * @brief leftmost position where any needle matches, on a tie the needle
+ * given first wins
+ *
+ * @param sm
+ * @param haystack
+ * @param hlen
+ * @param which index of the needle found, may be NULL
+ * @return const char* NULL if none matches
+ */
+const char *str_multi_search(const str_multi_t *sm, const char *haystack,
+                             size_t hlen, int *which);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
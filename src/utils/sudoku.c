@@ -0,0 +1,257 @@
+/**
+ * @file sudoku.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "sudoku.h"
+
+#define ALL_DIGITS 0x1FF
+
+#define ROW(c) ((c) / 9)
+#define COL(c) ((c) % 9)
+#define BOX(c) ((c) / 27 * 3 + (c) % 9 / 3)
+
+bool sudoku_valid(const sudoku_grid_t grid)
+{
+    uint16_t row[9] = {0}, col[9] = {0}, box[9] = {0};
+
+    for (int c = 0; c < SUDOKU_CELLS; c++) {
+        if (grid[c] == 0) {
+            continue;
+        }
+        uint16_t bit = (uint16_t)(1 << (grid[c] - 1));
+        int r = ROW(c), k = COL(c), b = BOX(c);
+        if ((row[r] | col[k] | box[b]) & bit) {
+            return false;
+        }
+        row[r] |= bit;
+        col[k] |= bit;
+        box[b] |= bit;
+    }
+    return true;
+}
+
+bool sudoku_valid_board(char *const *board)
+{
+    uint16_t row[9] = {0}, col[9] = {0}, box[9] = {0};
+
+    for (int r = 0; r < 9; r++) {
+        for (int k = 0; k < 9; k++) {
+            char ch = board[r][k];
+            if (ch < '1' || ch > '9') {
+                continue;
+            }
+            uint16_t bit = (uint16_t)(1 << (ch - '1'));
+            int b = r / 3 * 3 + k / 3;
+            if ((row[r] | col[k] | box[b]) & bit) {
+                return false;
+            }
+            row[r] |= bit;
+            col[k] |= bit;
+            box[b] |= bit;
+        }
+    }
+    return true;
+}
+
+void sudoku_parse(const char *s, sudoku_grid_t grid)
+{
+    for (int c = 0; c < SUDOKU_CELLS; c++) {
+        grid[c] = s[c] >= '1' && s[c] <= '9' ? (uint8_t)(s[c] - '0') : 0;
+    }
+}
+
+/* a search node, copied whole when branching, 224 bytes */
+typedef struct {
+    uint16_t row[9], col[9], box[9]; /* digits placed */
+    uint8_t empty[SUDOKU_CELLS]; /* cells still open, unordered */
+    int num_empty;
+    sudoku_grid_t grid;
+} node_t;
+
+typedef struct {
+    int found;
+    int max;
+    sudoku_grid_t first;
+} search_t;
+
+/* cells of the 27 units, rows then columns then boxes */
+static const uint8_t units[27][9] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8},
+    {9, 10, 11, 12, 13, 14, 15, 16, 17},
+    {18, 19, 20, 21, 22, 23, 24, 25, 26},
+    {27, 28, 29, 30, 31, 32, 33, 34, 35},
+    {36, 37, 38, 39, 40, 41, 42, 43, 44},
+    {45, 46, 47, 48, 49, 50, 51, 52, 53},
+    {54, 55, 56, 57, 58, 59, 60, 61, 62},
+    {63, 64, 65, 66, 67, 68, 69, 70, 71},
+    {72, 73, 74, 75, 76, 77, 78, 79, 80},
+    {0, 9, 18, 27, 36, 45, 54, 63, 72},
+    {1, 10, 19, 28, 37, 46, 55, 64, 73},
+    {2, 11, 20, 29, 38, 47, 56, 65, 74},
+    {3, 12, 21, 30, 39, 48, 57, 66, 75},
+    {4, 13, 22, 31, 40, 49, 58, 67, 76},
+    {5, 14, 23, 32, 41, 50, 59, 68, 77},
+    {6, 15, 24, 33, 42, 51, 60, 69, 78},
+    {7, 16, 25, 34, 43, 52, 61, 70, 79},
+    {8, 17, 26, 35, 44, 53, 62, 71, 80},
+    {0, 1, 2, 9, 10, 11, 18, 19, 20},
+    {3, 4, 5, 12, 13, 14, 21, 22, 23},
+    {6, 7, 8, 15, 16, 17, 24, 25, 26},
+    {27, 28, 29, 36, 37, 38, 45, 46, 47},
+    {30, 31, 32, 39, 40, 41, 48, 49, 50},
+    {33, 34, 35, 42, 43, 44, 51, 52, 53},
+    {54, 55, 56, 63, 64, 65, 72, 73, 74},
+    {57, 58, 59, 66, 67, 68, 75, 76, 77},
+    {60, 61, 62, 69, 70, 71, 78, 79, 80},
+};
+
+static inline uint16_t candidates(const node_t *n, int c)
+{
+    return ~(n->row[ROW(c)] | n->col[COL(c)] | n->box[BOX(c)]) & ALL_DIGITS;
+}
+
+static inline void place(node_t *n, int c, uint16_t bit)
+{
+    n->grid[c] = (uint8_t)(__builtin_ctz(bit) + 1);
+    n->row[ROW(c)] |= bit;
+    n->col[COL(c)] |= bit;
+    n->box[BOX(c)] |= bit;
+}
+
+/* digits only one open cell of a unit can take, false on a unit that
+   cannot complete */
+static bool hidden_singles(node_t *n, bool *progress)
+{
+    for (int u = 0; u < 27; u++) {
+        uint16_t once = 0, twice = 0, placed = 0;
+        for (int j = 0; j < 9; j++) {
+            int c = units[u][j];
+            if (n->grid[c] != 0) {
+                placed |= 1 << (n->grid[c] - 1);
+                continue;
+            }
+            uint16_t m = candidates(n, c);
+            twice |= once & m;
+            once |= m;
+        }
+        if ((once | placed) != ALL_DIGITS) {
+            return false;
+        }
+        uint16_t single = once & ~twice;
+        for (int j = 0; j < 9 && single != 0; j++) {
+            int c = units[u][j];
+            if (n->grid[c] != 0) {
+                continue;
+            }
+            uint16_t hit = candidates(n, c) & single;
+            if (hit == 0) {
+                continue;
+            }
+            if (hit & (hit - 1)) {
+                return false; /* one cell is the only home of two digits */
+            }
+            place(n, c, hit);
+            single &= ~hit;
+            *progress = true;
+        }
+    }
+    return true;
+}
+
+/* naked singles until none is left, then hidden singles, repeated while
+   anything is placed, the open cell with the fewest candidates goes to
+   *best, -1 once the grid is full, false on a contradiction */
+static bool propagate(node_t *n, int *best)
+{
+    bool progress = true;
+
+    while (progress) {
+        progress = false;
+        int fewest = 10;
+        *best = -1;
+        for (int i = 0; i < n->num_empty;) {
+            int c = n->empty[i];
+            uint16_t m = candidates(n, c);
+            int cnt = __builtin_popcount(m);
+            if (n->grid[c] != 0) {
+                n->empty[i] = n->empty[--n->num_empty];
+            } else if (cnt == 0) {
+                return false;
+            } else if (cnt == 1) {
+                place(n, c, m);
+                n->empty[i] = n->empty[--n->num_empty];
+                progress = true;
+            } else {
+                if (cnt < fewest) {
+                    fewest = cnt;
+                    *best = c;
+                }
+                i++;
+            }
+        }
+        if (!progress && n->num_empty > 0) {
+            if (!hidden_singles(n, &progress)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void search(node_t *n, search_t *s)
+{
+    int c;
+
+    if (!propagate(n, &c)) {
+        return;
+    }
+    if (c < 0) {
+        if (s->found++ == 0) {
+            memcpy(s->first, n->grid, SUDOKU_CELLS);
+        }
+        return;
+    }
+    uint16_t m = candidates(n, c);
+    while (m != 0 && s->found < s->max) {
+        uint16_t bit = m & -m;
+        m &= m - 1;
+        node_t child = *n;
+        place(&child, c, bit);
+        search(&child, s);
+    }
+}
+
+int sudoku_solve(sudoku_grid_t grid, int max_solutions)
+{
+    node_t n;
+    search_t s;
+
+    if (!sudoku_valid(grid) || max_solutions <= 0) {
+        return 0;
+    }
+    memset(&n, 0, sizeof(n));
+    memcpy(n.grid, grid, SUDOKU_CELLS);
+    for (int c = 0; c < SUDOKU_CELLS; c++) {
+        if (grid[c] != 0) {
+            place(&n, c, (uint16_t)(1 << (grid[c] - 1)));
+        } else {
+            n.empty[n.num_empty++] = (uint8_t)c;
+        }
+    }
+    s.found = 0;
+    s.max = max_solutions;
+    search(&n, &s);
+    if (s.found > 0) {
+        memcpy(grid, s.first, SUDOKU_CELLS);
+    }
+    return s.found;
+}
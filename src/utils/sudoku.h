@@ -0,0 +1,67 @@
+/**
+ * @file sudoku.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief 9x9 Sudoku over 9 bit digit masks, single pass validation and a
+ * solver that propagates naked and hidden singles before branching on
+ * the cell with the fewest candidates
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _SUDOKU_H_
+#define _SUDOKU_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SUDOKU_CELLS 81
+
+/* cells row by row, 0 for empty and 1..9 for a digit */
+typedef uint8_t sudoku_grid_t[SUDOKU_CELLS];
+
+/**
+ * @brief no digit twice in a row, column or box, empty cells allowed
+ *
+ * @param grid
+ * @return true
+ * @return false
+ */
+bool sudoku_valid(const sudoku_grid_t grid);
+
+/**
+ * @brief sudoku_valid for the LeetCode layout, '1'..'9' and '.'
+ *
+ * @param board 9 rows of 9 chars
+ * @return true
+ * @return false
+ */
+bool sudoku_valid_board(char *const *board);
+
+/**
+ * @brief read 81 chars, '1'..'9' are digits, anything else is empty
+ *
+ * @param s
+ * @param grid
+ */
+void sudoku_parse(const char *s, sudoku_grid_t grid);
+
+/**
+ * @brief solve in place, grid keeps the first solution found
+ *
+ * @param grid
+ * @param max_solutions stop after this many, 2 tells unique from not
+ * @return int solutions found, 0 when there is none or the clues clash
+ */
+int sudoku_solve(sudoku_grid_t grid, int max_solutions);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,304 @@
+/**
+ * @file timer_wheel.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/timerfd.h>
+
+#include "utils.h"
+#include "timer_wheel.h"
+
+#define TW_ROOT_MASK (TW_ROOT_SIZE - 1)
+#define TW_LEVEL_MASK (TW_LEVEL_SIZE - 1)
+/* shift of level n in 1..TW_LEVELS */
+#define TW_SHIFT(n) (TW_ROOT_BITS + ((n)-1) * TW_LEVEL_BITS)
+#define TW_INDEX(tw, n) (((tw)->jiffies >> TW_SHIFT(n)) & TW_LEVEL_MASK)
+
+static tw_timer_t **slot_head(timer_wheel_t *tw, int slot)
+{
+    if (slot < TW_ROOT_SIZE) {
+        return &tw->root[slot];
+    }
+    return &tw->levels[slot / TW_ROOT_SIZE - 1][slot & TW_LEVEL_MASK];
+}
+
+static void slot_mark(timer_wheel_t *tw, int slot, bool used)
+{
+    uint64_t *word;
+    int bit;
+
+    if (slot < TW_ROOT_SIZE) {
+        word = &tw->root_map[slot / 64];
+        bit = slot % 64;
+    } else {
+        word = &tw->level_map[slot / TW_ROOT_SIZE - 1];
+        bit = slot & TW_LEVEL_MASK;
+    }
+    if (used) {
+        *word |= BIT64(bit);
+    } else {
+        *word &= ~BIT64(bit);
+    }
+}
+
+/* first set bit in [start, 64), -1 if none */
+static int next_bit(uint64_t word, int start)
+{
+    if (start >= 64) {
+        return -1;
+    }
+    word &= ~0ull << start;
+    return word ? __builtin_ctzll(word) : -1;
+}
+
+/* first occupied root slot in [start, TW_ROOT_SIZE), -1 if none */
+static int root_next(const timer_wheel_t *tw, int start)
+{
+    for (int w = start / 64; w < TW_ROOT_SIZE / 64; w++) {
+        int bit = next_bit(tw->root_map[w], w == start / 64 ? start % 64 : 0);
+        if (bit >= 0) {
+            return w * 64 + bit;
+        }
+    }
+    return -1;
+}
+
+static void link_timer(timer_wheel_t *tw, tw_timer_t *timer)
+{
+    uint64_t expires = timer->expires;
+    uint64_t delta = expires - tw->jiffies;
+    int slot;
+
+    if ((int64_t)delta < 0) {
+        /* already due, run on the next tick */
+        slot = tw->jiffies & TW_ROOT_MASK;
+    } else if (delta < TW_ROOT_SIZE) {
+        slot = expires & TW_ROOT_MASK;
+    } else {
+        int n = 1;
+        while (n < TW_LEVELS && delta >= (1ull << TW_SHIFT(n + 1))) {
+            n++;
+        }
+        slot = n * TW_ROOT_SIZE + ((expires >> TW_SHIFT(n)) & TW_LEVEL_MASK);
+    }
+
+    tw_timer_t **head = slot_head(tw, slot);
+    timer->slot = (uint16_t)slot;
+    timer->next = *head;
+    if (timer->next != NULL) {
+        timer->next->pprev = &timer->next;
+    }
+    *head = timer;
+    timer->pprev = head;
+    slot_mark(tw, slot, true);
+}
+
+static void unlink_timer(timer_wheel_t *tw, tw_timer_t *timer)
+{
+    *timer->pprev = timer->next;
+    if (timer->next != NULL) {
+        timer->next->pprev = timer->pprev;
+    }
+    if (*slot_head(tw, timer->slot) == NULL) {
+        slot_mark(tw, timer->slot, false);
+    }
+    timer->next = NULL;
+    timer->pprev = NULL;
+}
+
+/* move every timer of a higher level slot to the level it now belongs to */
+static int cascade(timer_wheel_t *tw, int n, int index)
+{
+    int slot = n * TW_ROOT_SIZE + index;
+    tw_timer_t *timer = *slot_head(tw, slot);
+
+    *slot_head(tw, slot) = NULL;
+    slot_mark(tw, slot, false);
+    while (timer != NULL) {
+        tw_timer_t *next = timer->next;
+        link_timer(tw, timer);
+        timer = next;
+    }
+    return index;
+}
+
+/* on reaching a root wrap pull the due slot of level 1 down, and of
+   level 2 when level 1 wrapped too, and so on */
+static void cascade_on_wrap(timer_wheel_t *tw)
+{
+    if ((tw->jiffies & TW_ROOT_MASK) != 0 || tw->pending == 0) {
+        return;
+    }
+    for (int n = 1; n <= TW_LEVELS; n++) {
+        if (cascade(tw, n, TW_INDEX(tw, n)) != 0) {
+            break;
+        }
+    }
+}
+
+void timer_wheel_init(timer_wheel_t *tw, uint32_t tick_us)
+{
+    memset(tw, 0, sizeof(timer_wheel_t));
+    tw->tick_ns = (uint64_t)(tick_us ? tick_us : 1) * 1000;
+    tw->start_ns = get_time_ns();
+}
+
+void tw_timer_init(tw_timer_t *timer, tw_callback_t cb, void *arg)
+{
+    memset(timer, 0, sizeof(tw_timer_t));
+    timer->cb = cb;
+    timer->arg = arg;
+}
+
+void timer_wheel_add(timer_wheel_t *tw, tw_timer_t *timer, uint64_t ticks)
+{
+    if (tw_timer_pending(timer)) {
+        unlink_timer(tw, timer);
+    } else {
+        tw->pending++;
+    }
+    timer->expires = tw->jiffies + MIN(ticks, TW_MAX_TICKS);
+    link_timer(tw, timer);
+}
+
+void timer_wheel_del(timer_wheel_t *tw, tw_timer_t *timer)
+{
+    if (tw_timer_pending(timer)) {
+        unlink_timer(tw, timer);
+        tw->pending--;
+    }
+}
+
+int timer_wheel_advance(timer_wheel_t *tw, uint64_t ticks)
+{
+    int fired = 0;
+
+    while (ticks > 0) {
+        int index = tw->jiffies & TW_ROOT_MASK;
+
+        /* jump over empty root slots, never past the next cascade */
+        int busy = root_next(tw, index);
+        uint64_t idle = busy < 0 ? TW_ROOT_SIZE - index : busy - index;
+        if (idle > 0) {
+            idle = MIN(idle, ticks);
+            tw->jiffies += idle;
+            ticks -= idle;
+            cascade_on_wrap(tw);
+            continue;
+        }
+
+        /* detach first, callbacks may re-add into this slot or cancel
+           timers still waiting in work, pprev keeps both safe */
+        tw_timer_t *work = tw->root[index];
+        tw->root[index] = NULL;
+        slot_mark(tw, index, false);
+        work->pprev = &work;
+        tw->jiffies++;
+        ticks--;
+        while (work != NULL) {
+            tw_timer_t *timer = work;
+            work = timer->next;
+            if (work != NULL) {
+                work->pprev = &work;
+            }
+            timer->next = NULL;
+            timer->pprev = NULL;
+            tw->pending--;
+            timer->cb(timer, timer->arg);
+            fired++;
+        }
+        cascade_on_wrap(tw);
+    }
+    return fired;
+}
+
+uint64_t timer_wheel_next(const timer_wheel_t *tw)
+{
+    if (tw->pending == 0) {
+        return UINT64_MAX;
+    }
+
+    int index = tw->jiffies & TW_ROOT_MASK;
+    int busy = root_next(tw, index);
+    if (busy >= 0) {
+        return busy - index;
+    }
+
+    /* root slots behind index belong to the next turn, after the cascade */
+    uint64_t best = UINT64_MAX;
+    for (int w = 0; w < TW_ROOT_SIZE / 64; w++) {
+        if (tw->root_map[w] != 0) {
+            best = TW_ROOT_SIZE - index;
+            break;
+        }
+    }
+    for (int n = 1; n <= TW_LEVELS; n++) {
+        uint64_t map = tw->level_map[n - 1];
+        if (map == 0) {
+            continue;
+        }
+        /* the slot cascaded at the k-th next boundary is cur + k */
+        int cur = TW_INDEX(tw, n);
+        int k = next_bit(map, cur + 1);
+        k = k >= 0 ? k - cur : next_bit(map, 0) + TW_LEVEL_SIZE - cur;
+        uint64_t boundary = ((tw->jiffies >> TW_SHIFT(n)) + k) << TW_SHIFT(n);
+        best = MIN(best, boundary - tw->jiffies);
+    }
+    return best;
+}
+
+int timer_wheel_poll(timer_wheel_t *tw)
+{
+    uint64_t now = (get_time_ns() - tw->start_ns) / tw->tick_ns;
+
+    if (tw->jiffies > now) {
+        return 0;
+    }
+    return timer_wheel_advance(tw, now + 1 - tw->jiffies);
+}
+
+/* saturates instead of wrapping to an arbitrary time */
+static uint64_t deadline_ns(const timer_wheel_t *tw, uint64_t ticks)
+{
+    uint64_t room = (UINT64_MAX - tw->start_ns) / tw->tick_ns - tw->jiffies;
+
+    return tw->start_ns + (tw->jiffies + MIN(ticks, room)) * tw->tick_ns;
+}
+
+int timer_wheel_sleep(timer_wheel_t *tw, uint64_t max_ticks)
+{
+    if (tw->pending == 0) {
+        return 0;
+    }
+    uint64_t ns = deadline_ns(tw, MIN(timer_wheel_next(tw), max_ticks));
+    struct timespec ts;
+
+    ts.tv_sec = ns / 1000000000ull;
+    ts.tv_nsec = ns % 1000000000ull;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) ==
+           EINTR) {
+    }
+    return timer_wheel_poll(tw);
+}
+
+int timer_wheel_arm_timerfd(const timer_wheel_t *tw, int fd)
+{
+    struct itimerspec its;
+
+    memset(&its, 0, sizeof(its));
+    if (tw->pending > 0) {
+        uint64_t ns = deadline_ns(tw, timer_wheel_next(tw));
+        its.it_value.tv_sec = ns / 1000000000ull;
+        its.it_value.tv_nsec = ns % 1000000000ull;
+    }
+    return timerfd_settime(fd, TFD_TIMER_ABSTIME, &its, NULL);
+}
@@ -0,0 +1,159 @@
+/**
+ * @file timer_wheel.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief hashed hierarchical timer wheel, O(1) add/cancel, idle waits
+ * sleep until the next slot with work instead of polling every tick
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _TIMER_WHEEL_H_
+#define _TIMER_WHEEL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    level 0: 256 slots, one tick each
+    level 1:  64 slots, 256 ticks each
+    level 2:  64 slots, 256 * 64 ticks each
+    level 3:  64 slots, 256 * 64^2 ticks each
+    level 4:  64 slots, 256 * 64^3 ticks each, 2^32 ticks in total
+    a slot of level n is moved down (cascaded) when level n-1 wraps
+*/
+#define TW_ROOT_BITS 8
+#define TW_LEVEL_BITS 6
+#define TW_ROOT_SIZE (1 << TW_ROOT_BITS)
+#define TW_LEVEL_SIZE (1 << TW_LEVEL_BITS)
+#define TW_LEVELS 4
+#define TW_MAX_TICKS 0xFFFFFFFFull
+
+struct tw_timer;
+typedef void (*tw_callback_t)(struct tw_timer *timer, void *arg);
+
+/* embedded in the user's object, the wheel never allocates */
+typedef struct tw_timer {
+    struct tw_timer *next;
+    struct tw_timer **pprev; /* NULL when not pending */
+    uint64_t expires; /* absolute tick */
+    uint16_t slot; /* level * TW_ROOT_SIZE + index, for the bitmap */
+    tw_callback_t cb;
+    void *arg;
+} tw_timer_t;
+
+typedef struct {
+    uint64_t jiffies; /* next tick to run */
+    uint64_t tick_ns;
+    uint64_t start_ns; /* CLOCK_MONOTONIC time of tick 0 */
+    uint64_t pending;
+    tw_timer_t *root[TW_ROOT_SIZE];
+    tw_timer_t *levels[TW_LEVELS][TW_LEVEL_SIZE];
+    /* non-empty slots, lets idle ticks be skipped in bulk */
+    uint64_t root_map[TW_ROOT_SIZE / 64];
+    uint64_t level_map[TW_LEVELS];
+} timer_wheel_t;
+
+/**
+ * @brief init an empty wheel, tick 0 is now
+ *
+ * @param tw
+ * @param tick_us tick length in microseconds
+ */
+void timer_wheel_init(timer_wheel_t *tw, uint32_t tick_us);
+
+/**
+ * @brief init a timer before first use
+ *
+ * @param timer
+ * @param cb run once when the timer expires, may re-add the timer
+ * @param arg
+ */
+void tw_timer_init(tw_timer_t *timer, tw_callback_t cb, void *arg);
+
+/**
+ * @brief is the timer scheduled
+ *
+ * @param timer
+ * @return true
+ * @return false
+ */
+static inline bool tw_timer_pending(const tw_timer_t *timer)
+{
+    return timer->pprev != NULL;
+}
+
+/**
+ * @brief schedule timer ticks from now, re-schedules a pending timer,
+ * delays above TW_MAX_TICKS are clamped
+ *
+ * @param tw
+ * @param timer
+ * @param ticks 0 fires on the next processed tick
+ */
+void timer_wheel_add(timer_wheel_t *tw, tw_timer_t *timer, uint64_t ticks);
+
+/**
+ * @brief cancel a timer, no-op if it is not pending
+ *
+ * @param tw
+ * @param timer
+ */
+void timer_wheel_del(timer_wheel_t *tw, tw_timer_t *timer);
+
+/**
+ * @brief run the next ticks, empty stretches are skipped using the bitmaps
+ *
+ * @param tw
+ * @param ticks
+ * @return int number of callbacks run
+ */
+int timer_wheel_advance(timer_wheel_t *tw, uint64_t ticks);
+
+/**
+ * @brief ticks from now until the wheel has work, either an expiry or a
+ * cascade that may bring one closer
+ *
+ * @param tw
+ * @return uint64_t UINT64_MAX if no timer is pending
+ */
+uint64_t timer_wheel_next(const timer_wheel_t *tw);
+
+/**
+ * @brief run every tick that is due by the monotonic clock
+ *
+ * @param tw
+ * @return int number of callbacks run
+ */
+int timer_wheel_poll(timer_wheel_t *tw);
+
+/**
+ * @brief clock_nanosleep until the next tick with work (at most max_ticks
+ * away) and then poll, returns at once when no timer is pending
+ *
+ * @param tw
+ * @param max_ticks
+ * @return int number of callbacks run
+ */
+int timer_wheel_sleep(timer_wheel_t *tw, uint64_t max_ticks);
+
+/**
+ * @brief arm a CLOCK_MONOTONIC timerfd for the next tick with work so the
+ * wheel can sit in an epoll loop, disarms it when nothing is pending
+ *
+ * @param tw
+ * @param fd from timerfd_create(CLOCK_MONOTONIC, ...)
+ * @return int 0 on success, -1 on error
+ */
+int timer_wheel_arm_timerfd(const timer_wheel_t *tw, int fd);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,243 @@
+/**
+ * @file unrolled_list.c
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "unrolled_list.h"
+
+static ulist_node_t *ulist_node_create(void)
+{
+    void *p = NULL;
+
+    /* one node is one cache line, keep it aligned to the line */
+    if (posix_memalign(&p, CACHE_LINE_SIZE, sizeof(ulist_node_t)) != 0) {
+        printf("Memory allocation failed.\n");
+        return NULL;
+    }
+    ulist_node_t *node = (ulist_node_t *)p;
+    node->next = NULL;
+    node->count = 0;
+    return node;
+}
+
+/* take slot out of node, prev is the node before it (NULL for head) */
+static int ulist_erase(ulist_t *list, ulist_node_t *prev, ulist_node_t *node,
+                       int slot)
+{
+    int val = node->data[slot];
+
+    memmove(&node->data[slot], &node->data[slot + 1],
+            sizeof(int) * (node->count - slot - 1));
+    node->count--;
+    list->size--;
+
+    if (node->count == 0) {
+        if (prev == NULL) {
+            list->head = node->next;
+        } else {
+            prev->next = node->next;
+        }
+        if (list->tail == node) {
+            list->tail = prev;
+        }
+        free(node);
+        return val;
+    }
+
+    /* keep nodes at least half full so traversal stays dense */
+    ulist_node_t *next = node->next;
+    if (node->count < ULIST_NODE_CAP / 2 && next != NULL &&
+        node->count + next->count <= ULIST_NODE_CAP) {
+        memcpy(&node->data[node->count], next->data, sizeof(int) * next->count);
+        node->count += next->count;
+        node->next = next->next;
+        if (list->tail == next) {
+            list->tail = node;
+        }
+        free(next);
+    }
+    return val;
+}
+
+void ulist_init(ulist_t *list)
+{
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+}
+
+void ulist_destroy(ulist_t *list)
+{
+    ulist_node_t *node = list->head;
+
+    while (node != NULL) {
+        ulist_node_t *next = node->next;
+        free(node);
+        node = next;
+    }
+    ulist_init(list);
+}
+
+int ulist_push_back(ulist_t *list, int val)
+{
+    if (list->tail == NULL || list->tail->count == ULIST_NODE_CAP) {
+        ulist_node_t *node = ulist_node_create();
+        if (node == NULL) {
+            return -1;
+        }
+        if (list->tail == NULL) {
+            list->head = node;
+        } else {
+            list->tail->next = node;
+        }
+        list->tail = node;
+    }
+    list->tail->data[list->tail->count++] = val;
+    list->size++;
+    return 0;
+}
+
+int ulist_push_front(ulist_t *list, int val)
+{
+    if (list->head == NULL || list->head->count == ULIST_NODE_CAP) {
+        ulist_node_t *node = ulist_node_create();
+        if (node == NULL) {
+            return -1;
+        }
+        node->next = list->head;
+        if (list->head == NULL) {
+            list->tail = node;
+        }
+        list->head = node;
+    }
+
+    ulist_node_t *head = list->head;
+    memmove(&head->data[1], &head->data[0], sizeof(int) * head->count);
+    head->data[0] = val;
+    head->count++;
+    list->size++;
+    return 0;
+}
+
+int ulist_insert(ulist_t *list, size_t idx, int val)
+{
+    if (idx > list->size) {
+        return -1;
+    }
+    if (idx == list->size) {
+        return ulist_push_back(list, val);
+    }
+
+    ulist_node_t *node = list->head;
+    while (idx >= (size_t)node->count) {
+        idx -= node->count;
+        node = node->next;
+    }
+
+    if (node->count == ULIST_NODE_CAP) {
+        ulist_node_t *half = ulist_node_create();
+        if (half == NULL) {
+            return -1;
+        }
+        int keep = ULIST_NODE_CAP / 2;
+        half->count = node->count - keep;
+        memcpy(half->data, &node->data[keep], sizeof(int) * half->count);
+        node->count = keep;
+        half->next = node->next;
+        node->next = half;
+        if (list->tail == node) {
+            list->tail = half;
+        }
+        if (idx > (size_t)keep) {
+            idx -= keep;
+            node = half;
+        }
+    }
+
+    memmove(&node->data[idx + 1], &node->data[idx],
+            sizeof(int) * (node->count - idx));
+    node->data[idx] = val;
+    node->count++;
+    list->size++;
+    return 0;
+}
+
+int ulist_remove_at(ulist_t *list, size_t idx, int *val)
+{
+    if (idx >= list->size) {
+        return -1;
+    }
+
+    ulist_node_t *prev = NULL;
+    ulist_node_t *node = list->head;
+    while (idx >= (size_t)node->count) {
+        idx -= node->count;
+        prev = node;
+        node = node->next;
+    }
+
+    int ret = ulist_erase(list, prev, node, (int)idx);
+    if (val != NULL) {
+        *val = ret;
+    }
+    return 0;
+}
+
+bool ulist_remove(ulist_t *list, int val)
+{
+    ulist_node_t *prev = NULL;
+    ulist_node_t *node = list->head;
+
+    while (node != NULL) {
+        for (int i = 0; i < node->count; i++) {
+            if (node->data[i] == val) {
+                ulist_erase(list, prev, node, i);
+                return true;
+            }
+        }
+        prev = node;
+        node = node->next;
+    }
+    return false;
+}
+
+int ulist_get(const ulist_t *list, size_t idx, int *val)
+{
+    if (idx >= list->size) {
+        return -1;
+    }
+
+    const ulist_node_t *node = list->head;
+    while (idx >= (size_t)node->count) {
+        idx -= node->count;
+        node = node->next;
+    }
+    *val = node->data[idx];
+    return 0;
+}
+
+size_t ulist_size(const ulist_t *list)
+{
+    return list->size;
+}
+
+void ulist_print(const ulist_t *list)
+{
+    const ulist_node_t *node;
+    int i;
+
+    ULIST_FOREACH(list, node, i)
+    {
+        printf("%d -> ", node->data[i]);
+    }
+    printf("NULL\n");
+}
@@ -0,0 +1,146 @@
+/**
+ * @file unrolled_list.h
+ * @author hongzhijun (eehongzhijun@outlook.com)
+ * @brief unrolled linked list, every node packs several ints into one
+ * cache line so a traversal touches one line per ULIST_NODE_CAP elements
+ * instead of one line per element
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _UNROLLED_LIST_H_
+#define _UNROLLED_LIST_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CACHE_LINE_SIZE
+#define CACHE_LINE_SIZE 64
+#endif
+
+/* number of elements so that next + count + data fill exactly one line */
+#define ULIST_NODE_CAP \
+    ((int)((CACHE_LINE_SIZE - sizeof(void *) - sizeof(int)) / sizeof(int)))
+
+/*
+    head                                  tail
+    |                                     |
+    [n|cnt|d0 d1 .. dk] -> [n|cnt|d0 ..] -> NULL
+*/
+typedef struct ulist_node {
+    struct ulist_node *next;
+    int count;
+    int data[ULIST_NODE_CAP];
+} ulist_node_t;
+
+typedef struct {
+    ulist_node_t *head;
+    ulist_node_t *tail;
+    size_t size;
+} ulist_t;
+
+/* walk every element, node is ulist_node_t *, i is the slot in node */
+#define ULIST_FOREACH(list, node, i)                                   \
+    for ((node) = (list)->head; (node) != NULL; (node) = (node)->next) \
+        for ((i) = 0; (i) < (node)->count; (i)++)
+
+/**
+ * @brief init an empty list
+ *
+ * @param list
+ */
+void ulist_init(ulist_t *list);
+
+/**
+ * @brief free all nodes, list is empty afterwards
+ *
+ * @param list
+ */
+void ulist_destroy(ulist_t *list);
+
+/**
+ * @brief append val at the end, O(1)
+ *
+ * @param list
+ * @param val
+ * @return int 0 on success, -1 on allocation failure
+ */
+int ulist_push_back(ulist_t *list, int val);
+
+/**
+ * @brief insert val at the front
+ *
+ * @param list
+ * @param val
+ * @return int 0 on success, -1 on allocation failure
+ */
+int ulist_push_front(ulist_t *list, int val);
+
+/**
+ * @brief insert val so that it ends up at position idx, a full node is
+ * split in half before inserting
+ *
+ * @param list
+ * @param idx 0 <= idx <= size
+ * @param val
+ * @return int 0 on success, -1 on bad index or allocation failure
+ */
+int ulist_insert(ulist_t *list, size_t idx, int val);
+
+/**
+ * @brief remove the element at position idx, nodes dropping under half
+ * capacity are merged with their successor when both fit in one node
+ *
+ * @param list
+ * @param idx
+ * @param val removed value, may be NULL
+ * @return int 0 on success, -1 on bad index
+ */
+int ulist_remove_at(ulist_t *list, size_t idx, int *val);
+
+/**
+ * @brief remove the first element equal to val
+ *
+ * @param list
+ * @param val
+ * @return true found and removed
+ * @return false not found
+ */
+bool ulist_remove(ulist_t *list, int val);
+
+/**
+ * @brief get element at position idx
+ *
+ * @param list
+ * @param idx
+ * @param val
+ * @return int 0 on success, -1 on bad index
+ */
+int ulist_get(const ulist_t *list, size_t idx, int *val);
+
+/**
+ * @brief number of elements
+ *
+ * @param list
+ * @return size_t
+ */
+size_t ulist_size(const ulist_t *list);
+
+/**
+ * @brief print list content
+ *
+ * @param list
+ */
+void ulist_print(const ulist_t *list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
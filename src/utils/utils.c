@@ -16,6 +16,7 @@
 #include <math.h>
 #include <unistd.h>
 #include <limits.h>
+#include <time.h>
 
 #include <ctype.h>
 
@@ -456,3 +457,10 @@ int hamming_weight(int x)
         x &= x - 1;
     return count;
 }
+
+uint64_t get_time_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
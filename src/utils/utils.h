@@ -600,6 +600,13 @@ bool is_power_of_two(unsigned long n);
  */
 int hamming_weight(int x);
 
+/**
+ * @brief monotonic clock in nanoseconds, used to time benchmarks
+ *
+ * @return uint64_t
+ */
+uint64_t get_time_ns(void);
+
 #ifdef __cplusplus
 }
 #endif